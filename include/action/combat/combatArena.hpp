@@ -0,0 +1,220 @@
+/// @file   combatArena.hpp
+/// @brief  Define the arena used to measure the performance of combat.
+/// @author Enrico Fraccaroli
+/// @date   Oct 19 2026
+/// @copyright
+/// Copyright (c) 2016 Enrico Fraccaroli <enrico.fraccaroli@gmail.com>
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///     The above copyright notice and this permission notice shall be included
+///     in all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+
+
+#pragma once
+
+#include "structure/area.hpp"
+#include "structure/room.hpp"
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+class Mobile;
+class Race;
+class ItemModel;
+
+/// @brief A team of identical fighters.
+struct ArenaTeam
+{
+    /// The race of the fighters.
+    Race * race;
+    /// The number of fighters.
+    unsigned int size;
+    /// The model of the weapon wielded by the fighters, if any.
+    std::shared_ptr<ItemModel> weapon;
+};
+
+/// @brief The time spent inside a profiled function.
+struct ArenaTiming
+{
+    /// The name of the function.
+    const char * name;
+    /// The number of calls.
+    unsigned long calls;
+    /// The overall time (us).
+    double total;
+    /// The longest call (us).
+    double longest;
+};
+
+/// @brief Runs the combat between teams of mobiles, outside of the world.
+/// @details
+/// The fighters are placed inside a room which belongs to a private area, so
+///  that nobody in the world can see them, and they fight by executing their
+///  actions back to back, without waiting for the cooldowns. At the end of
+///  each round their health and stamina are restored, so that nobody dies
+///  and every round does the same amount of work.
+class CombatArena
+{
+private:
+    /// The arena currently running on this thread.
+    static thread_local CombatArena * current;
+    /// The area which contains the arena.
+    Area area;
+    /// The room where the fighters are placed.
+    Room room;
+    /// The teams.
+    std::vector<ArenaTeam> teams;
+    /// The fighters.
+    std::vector<Mobile *> fighters;
+    /// The time spent inside the profiled functions.
+    std::vector<ArenaTiming> timings;
+    /// The number of executed rounds.
+    unsigned int rounds;
+    /// The number of attacks resolved by the fighters, one for each weapon.
+    unsigned long attacks;
+    /// The overall damage dealt.
+    unsigned long damage;
+    /// The overall duration of the rounds (us).
+    double elapsed;
+    /// The number of allocations performed during the rounds.
+    unsigned long allocations;
+
+public:
+    /// @brief Constructor.
+    CombatArena();
+
+    /// @brief Destructor.
+    ~CombatArena();
+
+    /// @brief Disable copy constructor.
+    CombatArena(const CombatArena & source) = delete;
+
+    /// @brief Disable assignment operator.
+    CombatArena & operator=(const CombatArena &) = delete;
+
+    /// @brief Adds a team of fighters.
+    /// @param race   The race of the fighters.
+    /// @param size   The number of fighters.
+    /// @param weapon The model of the weapon, it can be a nullptr.
+    void addTeam(Race * race,
+                 const unsigned int & size,
+                 const std::shared_ptr<ItemModel> & weapon);
+
+    /// @brief Spawns the fighters and let them fight for the given number
+    ///         of rounds.
+    /// @param _rounds The number of rounds.
+    /// @param error   The error message.
+    /// @return <b>True</b> if the combat has been executed,<br>
+    ///         <b>False</b> otherwise.
+    bool run(const unsigned int & _rounds, std::string & error);
+
+    /// @brief Provides the number of executed rounds.
+    inline unsigned int getRounds() const
+    {
+        return rounds;
+    }
+
+    /// @brief Provides the number of attacks resolved by the fighters.
+    inline unsigned long getAttacks() const
+    {
+        return attacks;
+    }
+
+    /// @brief Provides the overall damage dealt.
+    inline unsigned long getDamage() const
+    {
+        return damage;
+    }
+
+    /// @brief Provides the overall duration of the rounds (us).
+    inline double getElapsed() const
+    {
+        return elapsed;
+    }
+
+    /// @brief Provides the number of allocations performed during the rounds.
+    inline unsigned long getAllocations() const
+    {
+        return allocations;
+    }
+
+    /// @brief Provides the time spent inside the profiled functions.
+    inline const std::vector<ArenaTiming> & getTimings() const
+    {
+        return timings;
+    }
+
+    /// @brief Checks if an arena is running on the calling thread.
+    static inline bool isRunning()
+    {
+        return current != nullptr;
+    }
+
+    /// @brief Adds the given number of resolved attacks to the arena
+    ///         running on the calling thread.
+    static void addAttacks(const unsigned int & amount);
+
+    /// @brief Adds the duration of a call to the given function to the
+    ///         timings of the arena running on the calling thread.
+    static void addTime(const char * name, const double & duration);
+
+private:
+    /// @brief Creates the fighters of the teams.
+    bool spawn(std::string & error);
+
+    /// @brief Creates the given weapon and let the fighter wield it.
+    bool equip(Mobile * fighter,
+               const std::shared_ptr<ItemModel> & weapon,
+               std::string & error);
+
+    /// @brief Removes the fighters.
+    void clear();
+};
+
+/// @brief Measures the time spent inside a function, while an arena is
+///         running on the calling thread.
+/// @details
+/// When no arena is running the probe does not even read the clock, so it
+///  can be left inside the combat functions.
+class ArenaProbe
+{
+private:
+    /// The name of the profiled function.
+    const char * name;
+    /// If the call is being measured.
+    bool active;
+    /// When the call has started.
+    std::chrono::high_resolution_clock::time_point start;
+
+public:
+    /// @brief Constructor.
+    explicit ArenaProbe(const char * _name);
+
+    /// @brief Destructor.
+    ~ArenaProbe();
+};
+
+/// @brief Runs the arena described by the arguments given on the command line
+///         and builds the report of its performance.
+/// @param args   The arguments: (race) (fighters) (race) (fighters) [rounds]
+///                [weapon] [weapon].
+/// @param report The report of the performance.
+/// @param error  The error message.
+/// @return <b>True</b> if the combat has been executed,<br>
+///         <b>False</b> otherwise.
+bool RunCombatArena(const std::vector<std::string> & args,
+                    std::string & report,
+                    std::string & error);
@@ -0,0 +1,93 @@
+/// @file   areaOfInterest.hpp
+/// @brief  Define the class AreaOfInterest.
+/// @author Enrico Fraccaroli
+/// @date   Oct 19 2026
+/// @copyright
+/// Copyright (c) 2016 Enrico Fraccaroli <enrico.fraccaroli@gmail.com>
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///     The above copyright notice and this permission notice shall be included
+///     in all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+#include <vector>
+
+#include "character/characterVector.hpp"
+
+class Room;
+
+/// @brief Keeps track of the rooms a character can see.
+/// @details
+/// The character subscribes as observer of every room inside its field of
+///  view, so that the events happening there can be delivered to it without
+///  computing its field of view for each event. The subscriptions are updated
+///  when the character moves, when its view distance changes or when the
+///  visibility around it changes (e.g. a door is opened).
+class AreaOfInterest
+{
+private:
+    /// The owner of the area of interest.
+    Character * owner;
+    /// The rooms in sight, sorted by address.
+    std::vector<Room *> rooms;
+    /// The radius used to compute the rooms in sight.
+    int radius;
+
+public:
+    /// @brief Constructor.
+    explicit AreaOfInterest(Character * _owner);
+
+    /// @brief Destructor.
+    ~AreaOfInterest();
+
+    /// @brief Disable copy constructor.
+    AreaOfInterest(const AreaOfInterest & source) = delete;
+
+    /// @brief Disable assign operator.
+    AreaOfInterest & operator=(const AreaOfInterest &) = delete;
+
+    /// @brief Recomputes the rooms in sight of the owner, subscribing to the
+    ///         rooms which entered its field of view and unsubscribing from
+    ///         the ones which left it.
+    void update();
+
+    /// @brief Updates the rooms in sight only if the view distance of the
+    ///         owner has changed since the last update.
+    void refresh();
+
+    /// @brief Unsubscribes from all the rooms.
+    void clear();
+
+    /// @brief Removes the given room from the rooms in sight, without
+    ///         notifying it.
+    /// @param room The room which is being destroyed.
+    void forget(Room * room);
+
+    /// @brief Checks if the given room is in sight.
+    /// @param room The room to check.
+    /// @return <b>True</b> if the room is in sight,<br>
+    ///         <b>False</b> otherwise.
+    bool canSee(Room * room) const;
+
+    /// @brief Provides the rooms in sight.
+    inline const std::vector<Room *> & getRooms() const
+    {
+        return rooms;
+    }
+
+    /// @brief Provides the characters inside the rooms in sight, except the
+    ///         owner.
+    CharacterVector getCharactersInSight() const;
+};
@@ -41,7 +41,11 @@
 #include "enumerators/characterPosture.hpp"
 #include "character/characterVector.hpp"
 #include "character/skill/skillManager.hpp"
+#include "character/areaOfInterest.hpp"
+#include "character/combatProfile.hpp"
 #include "item/itemUtils.hpp"
+#include "item/craftingIndex.hpp"
+#include "utilities/radMudTypes.hpp"
 
 #include <deque>
 #include <mutex>
@@ -112,6 +116,10 @@ public:
     ItemVector inventory;
     /// Character's equipment.
     ItemVector equipment;
+    /// Index of the tools and of the resources inside the inventory.
+    CraftingIndex inventoryIndex;
+    /// Index of the tools and of the resources inside the equipment.
+    CraftingIndex equipmentIndex;
     /// Character's posture.
     CharacterPosture posture;
     /// The lua_State associated with this character.
@@ -129,6 +137,14 @@ public:
     SkillManager skillManager;
     /// List of opponents.
     CombatHandler combatHandler;
+    /// The weapons and the armor class used during the combat.
+    CombatProfile combatProfile;
+    /// The rooms in sight of the character.
+    AreaOfInterest areaOfInterest;
+    /// Mark used to skip the character while fanning out a message.
+    unsigned long messageMark;
+    /// The messages produced while computing the TIC.
+    std::vector<std::string> ticMessages;
 
     /// @brief Constructor.
     Character();
@@ -395,6 +411,21 @@ public:
     /// @return The total carrying weight.
     double getCarryingWeight() const;
 
+    /// @brief Adds the given difference to the cached carrying weight.
+    /// @param difference The change of weight of the carried items.
+    void addCarryingWeight(double difference);
+
+    /// @brief Discards the cached carrying weight, so that it is evaluated
+    ///         again the next time it is needed.
+    void invalidateCarryingWeight();
+
+    /// @brief Checks that the cached carrying weight, and the ones of the
+    ///         carried items, match the ones evaluated from scratch,
+    ///         discarding the wrong ones.
+    /// @return <b>True</b> if the cached weights are correct,<br>
+    ///         <b>False</b> otherwise.
+    bool checkCarryingWeight() const;
+
     /// @brief The maximum carrying weight for this character.
     /// @return The maximum carrying weight.
     double getMaxCarryingWeight() const;
@@ -452,6 +483,18 @@ public:
     /// @brief Update the list of activated effects.
     void updateActivatedEffects();
 
+    /// @brief Evaluates the changes due to the passing of a TIC, i.e.
+    ///         regeneration, hunger, thirst and effects.
+    /// @details
+    /// Only the state of the character is changed, while the messages are
+    ///  kept aside until applyTic is called. Thus, it can be executed
+    ///  concurrently on different characters.
+    void computeTic();
+
+    /// @brief Applies the part of the TIC which involves the rest of the mud,
+    ///         like sending the messages produced by computeTic.
+    void applyTic();
+
     /// @brief Provide a detailed description of the character.
     /// @return A detailed description of the character.
     std::string getLook();
@@ -524,16 +567,40 @@ public:
     /// @param msg Message to send.
     virtual void sendMsg(const std::string & msg);
 
+    /// @brief Sends a message shared with other recipients to the character.
+    /// @param msg Message to send.
+    virtual void sendMsg(const SharedMessage & msg);
+
+    /// @brief Provides the buffer where the messages sent to the character
+    ///         are queued, if they can be written there directly.
+    /// @return The buffer, or nullptr if the messages must be built first.
+    virtual std::string * getOutputBuffer();
+
     /// @brief Sends a message to the character.
+    /// @details The message is built directly inside the output buffer of
+    ///           the character, when there is one.
     /// @param msg   The message to send
     /// @param args  Packed arguments.
     template<typename ... Args>
     void sendMsg(const std::string & msg, const Args & ... args)
     {
-        this->sendMsg(StringBuilder::build(msg, args ...));
+        auto buffer = this->getOutputBuffer();
+        if (buffer != nullptr)
+        {
+            StringBuilder::append(*buffer, msg, args ...);
+        }
+        else
+        {
+            this->sendMsg(StringBuilder::build(msg, args ...));
+        }
     }
 
 protected:
+    /// The cached weight of the inventory and of the equipment.
+    mutable double carryingWeight;
+    /// If the cached carrying weight is up to date.
+    mutable bool carryingWeightValid;
+
     void updateTicImpl() override;
 
     void updateHourImpl() override;
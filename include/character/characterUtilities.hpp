@@ -47,6 +47,8 @@ class Direction;
 
 class Production;
 
+class Profession;
+
 class ItemModel;
 
 template<typename WeaponItemType>
@@ -125,6 +127,16 @@ bool FindNearbyResouces(
     std::vector<std::pair<Item *, unsigned int>> & foundResources,
     const SearchOptionsCharacter & searchOptions);
 
+/// @brief Checks if the reserved resources are still available and are
+///         enough to satisfy the required ones.
+/// @param requiredResources    The list of required resources.
+/// @param reservedResources    The resources reserved by FindNearbyResouces.
+/// @return <b>True</b> if the resources are enough,<br>
+///         <b>False</b> otherwise.
+bool HasReservedResources(
+    const std::map<ResourceType, unsigned int> & requiredResources,
+    const std::vector<std::pair<Item *, unsigned int>> & reservedResources);
+
 /// @brief Search the given type of tool in the proximity of the character.
 /// @param character        The target character.
 /// @param toolType         The type of tool that has to be searched.
@@ -183,3 +195,13 @@ bool MoveCharacterTo(
 /// @return <b>True</b> has the required knowledge,<br>
 ///         <b>False</b> otherwise.
 bool HasRequiredKnowledge(Character * character, Production * production);
+
+/// @brief Evaluates which productions of the given profession the character
+///         can execute with the tools and the ingredients nearby.
+/// @param character    The target character.
+/// @param profession   The profession.
+/// @return The productions which can be executed, together with the number
+///          of times they can be executed with the available ingredients.
+std::vector<std::pair<Production *, unsigned int>> GetFeasibleProductions(
+    Character * character,
+    Profession * profession);
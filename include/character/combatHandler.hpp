@@ -22,15 +22,21 @@
 
 #pragma once
 
-#include <set>
 #include <vector>
 #include <string>
-#include <memory>
+#include <unordered_map>
 
 #include "character/characterVector.hpp"
+#include "utilities/random.hpp"
 
 /// @brief Data structure used to store an ordered list of opponents
 ///         during a combat.
+/// @details
+/// The opponents are kept inside a binary heap ordered by aggression, indexed
+///  by character, so that the top aggressor is available in constant time and
+///  changing the aggression of an opponent costs O(log n). Each handler also
+///  keeps track of the handlers which list its owner as opponent, so that the
+///  owner can be removed from all of them when it dies or leaves.
 class CombatHandler
 {
     friend class Character;
@@ -42,10 +48,13 @@ public:
         /// @brief Constructor.
         /// @param _aggressor  The aggressor.
         /// @param _aggression The aggro level.
+        /// @param _sequence   The order in which the aggressor has been added.
         Aggression(Character * _aggressor,
-                   unsigned int _aggression) :
+                   unsigned int _aggression,
+                   unsigned long _sequence) :
             aggressor(_aggressor),
-            aggression(_aggression)
+            aggression(_aggression),
+            sequence(_sequence)
         {
             /// Nothing to do.
         }
@@ -53,15 +62,27 @@ public:
         /// The aggressor.
         Character * aggressor;
         /// The level of aggression.
-        mutable unsigned int aggression;
+        unsigned int aggression;
+        /// The order in which the aggressor has been added, used to break
+        ///  the ties between equal levels of aggression.
+        unsigned long sequence;
     };
 
 private:
     /// Owner of the list.
     Character * owner;
 
-    /// List of opponents.
-    std::vector<std::shared_ptr<Aggression> > opponents;
+    /// Heap of opponents, the one with the highest aggression is the first.
+    std::vector<Aggression> opponents;
+
+    /// The position of each opponent inside the heap.
+    std::unordered_map<Character *, size_t> positions;
+
+    /// The handlers which have the owner among their opponents.
+    std::vector<CombatHandler *> engagedBy;
+
+    /// The order of the next added opponent.
+    unsigned long nextSequence;
 
     /// The predefined target.
     Character * predefinedTarget;
@@ -69,6 +90,13 @@ private:
     /// A pointer to the currently aimed character.
     Character * aimedCharacter;
 
+    /// The handlers which have the owner as predefined target or as aimed
+    ///  character.
+    std::vector<CombatHandler *> targetedBy;
+
+    /// The generator of the rolls of the combat, seeded when it starts.
+    Xoshiro256 generator;
+
 public:
     /// List of characters in sight.
     CharacterVector charactersInSight;
@@ -77,6 +105,7 @@ public:
     CombatHandler(Character * _owner);
 
     /// @brief Destructor.
+    /// @details Silently detaches the owner from all the other handlers.
     ~CombatHandler();
 
     /// @brief Tries to add the given character to the list of opponents.
@@ -115,6 +144,12 @@ public:
     /// @brief Provides the aimed target.
     Character * getAimedTarget();
 
+    /// @brief Provides the generator of the rolls of the combat.
+    inline Xoshiro256 & getGenerator()
+    {
+        return generator;
+    }
+
     /// @brief Allows to the a new aggression level to the given opponent.
     /// @param character      The opponent
     /// @param newAggression The new aggression level.
@@ -123,8 +158,8 @@ public:
     bool setAggro(Character * character, unsigned int newAggression);
 
     /// @brief Returns the current top aggressor.
-    /// @return The top aggressor.
-    std::shared_ptr<Aggression> getTopAggro();
+    /// @return The top aggressor, nullptr if there are no opponents.
+    const Aggression * getTopAggro() const;
 
     /// @brief Allows to elect the given character as the opponent with
     ///         the top level of aggro.
@@ -154,23 +189,43 @@ public:
 
     /// @brief Reset this list and all the ones linked to it.
     /// @details
-    /// Traverses the internal list of opponents and for each element
-    ///  removes from its list of opponents the actor which owns this list.
-    /// Then the element is removed from the list.
+    /// Removes the actor which owns this list from the list of opponents of
+    ///  all the characters which are fighting it. Then the list is cleared.
     void resetList();
 
+    /// @brief Provides the opponents, from the highest level of aggression
+    ///         to the lowest one.
+    std::vector<Aggression> getSortedOpponents() const;
+
     /// @brief Provides an iterator to the begin of the list of aggressors.
+    /// @details The aggressors are not sorted by aggression.
     /// @return An iterator to the begin of the vector of aggressors.
-    std::vector<std::shared_ptr<Aggression> >::iterator begin();
+    std::vector<Aggression>::const_iterator begin() const;
 
     /// @brief Provides an iterator to the end of the list of aggressors.
     /// @return An iterator to the end of the vector of aggressors.
-    std::vector<std::shared_ptr<Aggression> >::iterator end();
+    std::vector<Aggression>::const_iterator end() const;
 
 private:
-    /// @brief Sort the list of opponents.
-    void sortList();
+    /// @brief Checks if the first aggression comes before the second one.
+    static bool precedes(const Aggression & a, const Aggression & b);
+
+    /// @brief Moves the opponent towards the top of the heap.
+    void siftUp(size_t position);
+
+    /// @brief Moves the opponent towards the bottom of the heap.
+    void siftDown(size_t position);
+
+    /// @brief Places the opponent in the given position of the heap.
+    void place(Aggression && aggression, const size_t & position);
+
+    /// @brief Removes the opponent in the given position of the heap,
+    ///         without any side effect.
+    void detach(const size_t & position);
 
-    /// @brief Print the list of opponents.
-    void printList();
+    /// @brief Sets either the predefined target or the aimed character, and
+    ///         keeps track of this handler inside the handler of the target.
+    /// @param target    The predefined target or the aimed character.
+    /// @param character The new target.
+    void retarget(Character *& target, Character * character);
 };
@@ -0,0 +1,100 @@
+/// @file   combatProfile.hpp
+/// @brief  Define the class CombatProfile.
+/// @author Enrico Fraccaroli
+/// @date   Oct 19 2026
+/// @copyright
+/// Copyright (c) 2016 Enrico Fraccaroli <enrico.fraccaroli@gmail.com>
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///     The above copyright notice and this permission notice shall be included
+///     in all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "character/bodyPart.hpp"
+
+class Character;
+
+class MeleeWeaponItem;
+
+class RangedWeaponItem;
+
+class ArmorItem;
+
+/// @brief The values derived from the equipment and the abilities of a
+///         character which are used at every round of combat.
+/// @details
+/// The profile is computed the first time it is needed and reused until the
+///  equipment, the abilities or the effects of the character change.
+class CombatProfile
+{
+private:
+    /// The owner of the profile.
+    Character * owner;
+    /// If the cached values are up to date with the equipment.
+    mutable bool valid;
+    /// The version of the effects used to compute the cached values.
+    mutable unsigned long effectsVersion;
+    /// The melee weapons wielded by the owner.
+    mutable std::vector<MeleeWeaponItem *> meleeWeapons;
+    /// The ranged weapons wielded by the owner.
+    mutable std::vector<RangedWeaponItem *> rangedWeapons;
+    /// The natural weapons of the free body parts.
+    mutable std::vector<std::shared_ptr<BodyPart::BodyWeapon>> naturalWeapons;
+    /// The armors worn by the owner.
+    mutable std::vector<ArmorItem *> armors;
+    /// The agility modifier, effects included.
+    mutable unsigned int agilityModifier;
+    /// The stamina consumed by an attack, before adding the weight of the
+    ///  carried items and of the weapon.
+    mutable unsigned int baseStamina;
+
+public:
+    /// @brief Constructor.
+    /// @param _owner The owner of the profile.
+    explicit CombatProfile(Character * _owner);
+
+    /// @brief Destructor.
+    ~CombatProfile();
+
+    /// @brief Marks the profile as outdated, it must be called every time
+    ///         the equipment or the abilities of the owner change.
+    void invalidate();
+
+    /// @brief Provides the active melee weapons.
+    const std::vector<MeleeWeaponItem *> & getMeleeWeapons() const;
+
+    /// @brief Provides the active ranged weapons.
+    const std::vector<RangedWeaponItem *> & getRangedWeapons() const;
+
+    /// @brief Provides the active natural weapons.
+    const std::vector<std::shared_ptr<BodyPart::BodyWeapon>> &
+    getNaturalWeapons() const;
+
+    /// @brief Provides the overall armor class.
+    /// @details The armor class of each armor is evaluated every time, since
+    ///           it depends on the condition of the armor.
+    unsigned int getArmorClass() const;
+
+    /// @brief Provides the stamina consumed by an attack, before adding the
+    ///         weight of the carried items and of the weapon.
+    unsigned int getBaseStamina() const;
+
+private:
+    /// @brief Recomputes the cached values if they are outdated.
+    void refresh() const;
+};
@@ -38,6 +38,8 @@ private:
     std::vector<Effect> pendingEffects;
     /// The list of passive effects.
     std::vector<Effect> passiveEffects;
+    /// Incremented every time the modifiers change.
+    unsigned long version;
 
 public:
     /// @brief Constructor.
@@ -98,6 +100,13 @@ public:
         return passiveEffects;
     }
 
+    /// @brief Provides a counter which changes every time the modifiers
+    ///         change, used to invalidate the values derived from them.
+    inline unsigned long getVersion() const
+    {
+        return version;
+    }
+
 private:
 
     /// @brief Sort the list of active effects.
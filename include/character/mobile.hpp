@@ -73,6 +73,12 @@ public:
     /// @brief Destructor.
     ~Mobile();
 
+    /// @brief Allocates the mobile inside the pool of its size.
+    static void * operator new(size_t size);
+
+    /// @brief Gives the slot of the mobile back to its pool.
+    static void operator delete(void * pointer, size_t size);
+
     bool check() const override;
 
     bool isMobile() const override;
@@ -99,7 +105,7 @@ public:
     /// @param key The key to find.
     /// @return <b>True</b> if the operations succeeded,<br>
     ///         <b>False</b> Otherwise.
-    bool hasKey(const std::string & key) const;
+    bool hasKey(std::string_view key) const;
 
     /// @brief Check if the mobile has the desired action set.
     /// @param _action The action to check.
@@ -122,10 +128,14 @@ public:
     /// @brief Reload the LUA enviroment of the mobile.
     void reloadLua();
 
+    using Character::sendMsg;
+
     /// @brief Output to player (any type).
     /// @param msg The string to sent.
     void sendMsg(const std::string & msg) override;
 
+    std::string * getOutputBuffer() override;
+
     void performBehaviour();
 
     bool checkBehaviourTimer();
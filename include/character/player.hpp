@@ -23,6 +23,7 @@
 #pragma once
 
 #include <ctime>
+#include <deque>
 #include <list>
 #include <map>
 #include <set>
@@ -49,8 +50,12 @@ private:
     int port;
     /// Address player is from.
     std::string address;
-    /// Pending output.
+    /// Pending output, ready to be written on the socket.
     std::string outbuf;
+    /// Messages waiting to be moved inside the output buffer.
+    std::deque<SharedMessage> outqueue;
+    /// The last queued message, when it is owned only by this player.
+    std::shared_ptr<std::string> outtail;
     /// Pending input.
     std::string inbuf;
 
@@ -168,6 +173,12 @@ public:
     /// @param msg String to sent.
     void sendMsg(const std::string & msg) override;
 
+    /// @brief Output to player a message shared with other recipients.
+    /// @param msg The shared message.
+    void sendMsg(const SharedMessage & msg) override;
+
+    std::string * getOutputBuffer() override;
+
 protected:
     void updateTicImpl() override;
 
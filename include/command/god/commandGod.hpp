@@ -23,6 +23,16 @@
 
 #include "input/argumentHandler.hpp"
 #include "character/character.hpp"
+#include "utilities/table.hpp"
+
+/// The number of rows shown by each page of the god listings.
+const unsigned int GodListingPageRows = 100;
 
 /// Loads all the commands used by gods.
 void LoadGodCommands();
+
+/// Sends the page of a listing, telling how to see the other pages.
+void SendListingPage(Character * character,
+                     const Table & table,
+                     unsigned int page,
+                     const std::string & usage);
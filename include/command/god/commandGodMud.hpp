@@ -61,4 +61,22 @@ bool DoDeleteGenerateMap(Character * character, ArgumentHandler & args);
 /// Builds a generated map.
 bool DoBuildGenerateMap(Character * character, ArgumentHandler & args);
 
+/// Lists the maps being generated or built.
+bool DoMapJobs(Character * character, ArgumentHandler & args);
+
+/// Cancels the generation of a map.
+bool DoCancelMapJob(Character * character, ArgumentHandler & args);
+
+/// Shows the timings of the mud cycles and of the commands.
+bool DoProfile(Character * character, ArgumentHandler & args);
+
+/// Shows the most recent entries of the log.
+bool DoLog(Character * character, ArgumentHandler & args);
+
+/// Shows and sets the seeds of the random generators.
+bool DoRandom(Character * character, ArgumentHandler & args);
+
+/// Shows the state of the pools used to allocate items, rooms and mobiles.
+bool DoPools(Character * character, ArgumentHandler & args);
+
 ///@}
\ No newline at end of file
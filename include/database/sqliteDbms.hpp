@@ -23,6 +23,7 @@
 
 #pragma once
 
+#include <unordered_set>
 #include <vector>
 
 #include "sqliteWrapper.hpp"
@@ -93,6 +94,12 @@ public:
     ///         <b>False</b> Otherwise.
     bool searchPlayer(const std::string & name);
 
+    /// @brief Loads the names of all the players, in lower case.
+    /// @param names Where the names are added.
+    /// @return <b>True</b> if the operations succeeded,<br>
+    ///         <b>False</b> Otherwise.
+    bool loadPlayerNames(std::unordered_set<std::string> & names);
+
     /// @brief Execute an Insert Into query.
     /// @param table     Name of the table.
     /// @param args      Vector of arguments.
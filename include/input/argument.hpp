@@ -41,10 +41,10 @@ public:
     Argument(const std::string & _original);
 
     /// Provides the original argument.
-    std::string getOriginal() const;
+    const std::string & getOriginal() const;
 
     /// Provides the content with both index and multiplier removed.
-    std::string getContent() const;
+    const std::string & getContent() const;
 
     /// Provides the index.
     int & getIndex();
@@ -45,7 +45,7 @@ public:
     virtual ~ArgumentHandler();
 
     /// Provides the original input string.
-    std::string getOriginal();
+    const std::string & getOriginal() const;
 
     /// Returns the number of arguments.
     size_t size() const;
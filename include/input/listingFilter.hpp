@@ -0,0 +1,85 @@
+/// @file   listingFilter.hpp
+/// @brief  Define the filters used by the listing commands.
+/// @author Enrico Fraccaroli
+/// @date   Oct 19 2026
+/// @copyright
+/// Copyright (c) 2016 Enrico Fraccaroli <enrico.fraccaroli@gmail.com>
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///     The above copyright notice and this permission notice shall be included
+///     in all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+
+
+#pragma once
+
+#include "input/argumentHandler.hpp"
+
+#include <map>
+#include <string>
+#include <vector>
+
+/// @brief The filters of a listing command.
+/// @details
+/// The filters are written as "field:value" terms which must all be
+///  satisfied, e.g. "name:sword type:melee page:2". The "page" field is
+///  accepted by every listing.
+class ListingFilter
+{
+private:
+    /// The fields accepted by the listing.
+    std::vector<std::string> fields;
+    /// The values of the given fields, in lower case.
+    std::map<std::string, std::string> values;
+
+public:
+    /// @brief Constructor.
+    /// @param _fields The fields accepted by the listing.
+    explicit ListingFilter(std::vector<std::string> _fields);
+
+    /// @brief Reads the filters from the arguments.
+    /// @param args  The arguments of the command.
+    /// @param error In case of failure, contains the reason.
+    /// @return <b>True</b> if all the filters are valid,<br>
+    ///         <b>False</b> otherwise.
+    bool parse(ArgumentHandler & args, std::string & error);
+
+    /// @brief Provides the syntax of the filters.
+    std::string getUsage() const;
+
+    /// @brief Checks if the given field has been set.
+    bool has(const std::string & field) const;
+
+    /// @brief Provides the value of the field, in lower case.
+    std::string get(const std::string & field) const;
+
+    /// @brief Provides the value of the field, as a number.
+    int getNumber(const std::string & field) const;
+
+    /// @brief Provides the requested page, starting from 1.
+    unsigned int getPage() const;
+
+    /// @brief Checks if the value contains the text of the field, ignoring
+    ///         the case. It is satisfied if the field has not been set.
+    bool contains(const std::string & field, const std::string & value) const;
+
+    /// @brief Checks if the value begins with the text of the field,
+    ///         ignoring the case. It is satisfied if the field has not
+    ///         been set.
+    bool beginsWith(const std::string & field,
+                    const std::string & value) const;
+
+    /// @brief Checks if the value is equal to the number of the field.
+    ///         It is satisfied if the field has not been set.
+    bool equals(const std::string & field, int value) const;
+};
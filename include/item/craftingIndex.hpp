@@ -0,0 +1,71 @@
+/// @file   craftingIndex.hpp
+/// @brief  Define the index of the tools and of the resources.
+/// @author Enrico Fraccaroli
+/// @date   Oct 19 2026
+/// @copyright
+/// Copyright (c) 2016 Enrico Fraccaroli <enrico.fraccaroli@gmail.com>
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///     The above copyright notice and this permission notice shall be included
+///     in all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+#include "enumerators/resourceType.hpp"
+#include "enumerators/toolType.hpp"
+
+#include <map>
+#include <vector>
+
+class Item;
+
+/// @brief Index of the tools and of the resources contained inside a set of
+///         items, grouped by their type.
+/// @details
+/// The items are kept in the same order in which they have been added, so
+///  that the searches keep selecting the same item they would select by
+///  scanning the container.
+class CraftingIndex
+{
+private:
+    /// The tools grouped by type.
+    std::map<ToolType, std::vector<Item *>> tools;
+    /// The resources grouped by type.
+    std::map<ResourceType, std::vector<Item *>> resources;
+
+public:
+    /// @brief Constructor.
+    CraftingIndex();
+
+    /// @brief Adds the item to the index, if it is a tool or a resource.
+    /// @details If the item is already indexed, nothing is done.
+    void add(Item * item);
+
+    /// @brief Removes the item from the index.
+    void remove(Item * item);
+
+    /// @brief Removes all the items from the index.
+    void clear();
+
+    /// @brief Provides the tools of the given type.
+    const std::vector<Item *> & getTools(const ToolType & toolType) const;
+
+    /// @brief Provides the resources of the given type.
+    const std::vector<Item *> & getResources(
+        const ResourceType & resourceType) const;
+
+    /// @brief Provides the overall quantity of the resources of the
+    ///         given type.
+    unsigned int getQuantity(const ResourceType & resourceType) const;
+};
@@ -109,6 +109,12 @@ public:
     /// @brief Destructor.
     virtual ~Item();
 
+    /// @brief Allocates the item inside the pool of its size.
+    static void * operator new(size_t size);
+
+    /// @brief Gives the slot of the item back to its pool.
+    static void operator delete(void * pointer, size_t size);
+
     /// @brief Check the correctness of the item.
     /// @return <b>True</b> if the item has correct values,<br>
     ///         <b>False</b> otherwise.
@@ -161,13 +167,35 @@ public:
     /// @param key The key to search.
     /// @return <b>True</b> if the operations succeeded,<br>
     ///         <b>False</b> Otherwise.
-    bool hasKey(std::string key);
+    bool hasKey(const std::string & key) const;
+
+    /// @brief Provides the keys of the item, with the symbols of the model
+    /// keys replaced according to the item composition and quality.
+    std::vector<std::string> getKeys() const;
 
     /// @brief Provides the rate at which the item decays each TIC.
     virtual double getDecayRate() const;
 
     /// @brief Trigger a decay cycle.
-    virtual void triggerDecay();
+    void triggerDecay();
+
+    /// @brief Checks if the item decays with the passing of the hours.
+    virtual bool canDecay() const;
+
+    /// @brief Checks if the item has to be updated at each TIC.
+    virtual bool needsTic() const;
+
+    /// @brief Reduces the condition of the item by its decay rate.
+    /// @details
+    /// It changes only the condition of the item, so that it can be executed
+    ///  concurrently on different items.
+    /// @return <b>True</b> if the item is broken,<br>
+    ///         <b>False</b> otherwise.
+    bool decay();
+
+    /// @brief Takes the content out of the broken item and schedules its
+    ///         destruction.
+    void breakDown();
 
     /// @brief Provides the modifier due to the item's condition.
     double getConditionModifier() const;
@@ -189,6 +217,24 @@ public:
     /// @return The total weight of the item.
     virtual double getWeight(bool entireStack) const;
 
+    /// @brief Provides the weight of the contained items, which is kept
+    ///         cached between the changes of the content.
+    /// @return The weight of the content.
+    double getContentWeight() const;
+
+    /// @brief Discards the cached weight of the item and of the containers
+    ///         and character holding it. It must be called whenever the
+    ///         weight changes outside putInside and takeOut, e.g. when the
+    ///         quantity of the item changes.
+    void invalidateWeight();
+
+    /// @brief Checks that the cached weights of the item and of its content
+    ///         match the ones evaluated from scratch, discarding the wrong
+    ///         ones.
+    /// @return <b>True</b> if the cached weights are correct,<br>
+    ///         <b>False</b> otherwise.
+    bool checkWeight() const;
+
     /// @brief Return the name of the item.
     /// @param colored If <b>true</b> the name also include formatting color.
     /// @return The name of the item.
@@ -199,6 +245,10 @@ public:
     /// @return The name of the item.
     virtual std::string getNameCapital(bool colored = false) const;
 
+    /// @brief Provides the names of the item, shared with all the items
+    ///         having the same model, material and quality.
+    const ItemNames & getNames() const;
+
     /// @brief Return the description of the item.
     /// @return The description of the item.
     std::string getDescription();
@@ -259,6 +309,13 @@ public:
     /// @return The item, if it's in the container.
     Item * findContent(std::string search_parameter, int & number);
 
+    /// @brief Notifies the item that its content has changed, either because
+    ///         an item has been put inside or taken out, or because the
+    ///         quantity or the condition of a contained item has changed.
+    /// @details It can be called by the updater threads while the items
+    ///           decay, thus the overrides must be thread-safe.
+    virtual void contentChanged();
+
     /// @brief Set the body parts occupied by the item.
     /// @param _occupiedBodyParts The occupied body parts.
     void setOccupiedBodyParts(
@@ -268,6 +325,17 @@ public:
     bool operator<(Item & rhs) const;
 
 protected:
+    /// The names of the item.
+    mutable std::shared_ptr<const ItemNames> names;
+    /// The cached weight of the content.
+    mutable double contentWeight;
+    /// If the cached weight of the content is up to date.
+    mutable bool contentWeightValid;
+
+    /// @brief Adds the given difference to the cached weight of the content
+    ///         and to the ones of the containers and character holding it.
+    void addContentWeight(double difference);
+
     void updateTicImpl() override;
 
     void updateHourImpl() override;
@@ -0,0 +1,95 @@
+/// @file   itemQueryIndex.hpp
+/// @brief  Define the indices used to search the items of the world.
+/// @author Enrico Fraccaroli
+/// @date   Oct 19 2026
+/// @copyright
+/// Copyright (c) 2016 Enrico Fraccaroli <enrico.fraccaroli@gmail.com>
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///     The above copyright notice and this permission notice shall be included
+///     in all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+
+
+#pragma once
+
+#include <map>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class Item;
+
+/// The items sharing the same key of an index, sorted by vnum.
+using ItemBucket = std::map<int, Item *>;
+
+/// @brief Secondary indices on the items of the world, used by the
+///         listing commands to avoid scanning all the items.
+/// @details
+/// Only the values which do not change during the life of an item (its
+///  model, type and name) are indexed, the location of the items is checked
+///  on the candidates found through the indices.
+class ItemQueryIndex
+{
+private:
+    /// The buckets in which an item has been indexed.
+    struct Entry
+    {
+        /// The bucket of the model.
+        ItemBucket * model;
+        /// The bucket of the type.
+        ItemBucket * type;
+        /// The bucket of the name.
+        std::map<std::string, ItemBucket>::iterator name;
+    };
+
+    /// The items grouped by model vnum.
+    std::map<int, ItemBucket> models;
+    /// The items grouped by type name, in lower case.
+    std::map<std::string, ItemBucket> types;
+    /// The items grouped by their plain name, without decorations like the
+    ///  one of lit lights, in lower case.
+    std::map<std::string, ItemBucket> names;
+    /// The names containing each sequence of three characters.
+    std::map<std::string, std::set<const std::string *>> trigrams;
+    /// The indexed items.
+    std::unordered_map<Item *, Entry> entries;
+
+public:
+    /// @brief Constructor.
+    ItemQueryIndex();
+
+    /// @brief Adds the item to the index.
+    /// @details If the item is already indexed, nothing is done.
+    void add(Item * item);
+
+    /// @brief Removes the item from the index.
+    void remove(Item * item);
+
+    /// @brief Provides the items of the given model, sorted by vnum.
+    std::vector<Item *> findByModel(int modelVnum) const;
+
+    /// @brief Provides the items whose type begins with the given prefix,
+    ///         sorted by vnum.
+    std::vector<Item *> findByType(const std::string & prefix) const;
+
+    /// @brief Provides the items whose name contains the given text, sorted
+    ///         by vnum.
+    std::vector<Item *> findByName(const std::string & text) const;
+
+private:
+    /// @brief Merges the given buckets into a list sorted by vnum.
+    static std::vector<Item *> merge(
+        const std::vector<const ItemBucket *> & buckets);
+};
@@ -36,9 +36,10 @@ inline Item * FindItemIn(std::vector<Item *> const & container,
                          std::string const & key,
                          int & number)
 {
+    auto lowerKey = ToLower(key);
     for (auto item : container)
     {
-        if (!item->hasKey(ToLower(key))) continue;
+        if (!item->hasKey(lowerKey)) continue;
         if (number == 1) return item;
         --number;
     }
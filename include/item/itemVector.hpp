@@ -26,6 +26,19 @@ class Item;
 #include <vector>
 #include <string>
 
+/// @brief A group of items which are shown as a single entry.
+struct ItemGroup
+{
+    /// The first item of the group.
+    Item * item;
+    /// The number of items inside the group.
+    unsigned int items;
+    /// The overall quantity of the items.
+    unsigned int quantity;
+    /// The overall weight of the items.
+    double weight;
+};
+
 /// @brief Custom vector of items.
 class ItemVector :
     public std::vector<Item *>
@@ -65,8 +78,11 @@ public:
     /// @details
     /// There are some items which canno be stacked, thus this function
     /// provides a stacked list which should ease printing the content.
+    /// The items are grouped when they have the same model, material,
+    ///  quality and state (built or lit), unless they contain other items.
+    /// The groups follow the order of their first item.
     /// @return The stacked version of the content.
-    std::vector<std::pair<Item *, int>> toStack() const;
+    std::vector<ItemGroup> toStack() const;
 
     /// Orders the content based on the given parameter.
     void orderBy(const Order & order);
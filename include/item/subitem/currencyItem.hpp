@@ -38,5 +38,5 @@ public:
 
     double getWeight(bool entireStack) const override;
 
-    void triggerDecay() override;
+    bool canDecay() const override;
 };
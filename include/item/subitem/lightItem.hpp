@@ -46,6 +46,8 @@ public:
 
     double getTotalSpace() const override;
 
+    bool needsTic() const override;
+
     /// @brief Checks if the light source is active.
     bool isActive() const;
 
@@ -23,6 +23,10 @@
 
 #include "item/item.hpp"
 #include "character/mobile.hpp"
+#include "utilities/keywordIndex.hpp"
+
+#include <atomic>
+#include <unordered_map>
 
 /// @brief Holds details about shops.
 class ShopItem :
@@ -86,4 +90,34 @@ public:
     /// @param item The item that has to be priced.
     /// @return The sell price with applied the taxes.
     unsigned int evaluateSellPrice(Item * item);
+
+    /// @brief Search for a good on sale.
+    /// @param key    The keyword of the good.
+    /// @param number Position of the good we want to look for.
+    /// @return The good, if it's on sale.
+    Item * findGood(const std::string & key, int & number);
+
+    void contentChanged() override;
+
+private:
+    /// @brief The prices of a good on sale.
+    struct ShopGood
+    {
+        /// The price with applied the buy tax.
+        unsigned int buyPrice;
+        /// The price with applied the sell tax.
+        unsigned int sellPrice;
+    };
+
+    /// The goods on sale with their prices.
+    std::unordered_map<Item *, ShopGood> goods;
+    /// The goods on sale indexed by keyword.
+    KeywordIndex<Item> goodsIndex;
+    /// The rendered table of the goods on sale.
+    std::string saleTable;
+    /// If the catalogue reflects the content of the shop.
+    std::atomic<bool> catalogueValid;
+
+    /// @brief Builds the catalogue again if the content has changed.
+    void updateCatalogue();
 };
@@ -34,6 +34,8 @@
 #include <set>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <atomic>
 
 /// Used to determine the flag of the model.
 using ModelFlag = enum class ModelFlag_t
@@ -101,6 +103,24 @@ class RangedWeaponModel;
 
 class MagazineModel;
 
+/// @brief The names of the items of a model, with a given material and
+///         quality, computed only once and shared by all of them.
+struct ItemNames
+{
+    /// The material for which the names have been computed.
+    Material * composition;
+    /// The quality for which the names have been computed.
+    ItemQuality quality;
+    /// The version of the model when the names have been computed.
+    unsigned int version;
+    /// The name.
+    std::string name;
+    /// The name with the first letter capitalized.
+    std::string nameCapital;
+    /// The keys, with the symbols replaced.
+    std::vector<std::string> keys;
+};
+
 /// @brief Holds details about a model of item.
 class ItemModel :
     public std::enable_shared_from_this<ItemModel>
@@ -211,6 +231,25 @@ public:
                         const ItemQuality & itemQuality =
                         ItemQuality::Normal) const;
 
+    /// @brief Provides the names of the items of this model with the given
+    ///         material and quality.
+    /// @details
+    /// The names are computed the first time they are required, and then
+    ///  shared by all the items with the same material and quality.
+    std::shared_ptr<const ItemNames> getNames(
+        Material * itemMaterial,
+        const ItemQuality & itemQuality) const;
+
+    /// @brief Provides the current version of the names of the model.
+    inline unsigned int getNamesVersion() const
+    {
+        return namesVersion;
+    }
+
+    /// @brief Discards the names computed so far, it must be called after
+    ///         the name, the short description or the keys are changed.
+    void invalidateNames();
+
     /// @brief Returns the description of the model depending
     ///         on the passed arguments.
     /// @param itemMaterial The material of which the model is made.
@@ -299,6 +338,15 @@ public:
 
     /// @brief Returns the model <b>statically</b> casted to Magazine.
     std::shared_ptr<MagazineModel> toMagazine();
+
+private:
+    /// The names computed so far, by material and quality.
+    mutable std::map<std::pair<Material *, unsigned int>,
+        std::shared_ptr<const ItemNames>> names;
+    /// The version of the names, which changes each time they are discarded.
+    std::atomic<unsigned int> namesVersion;
+    /// Mutex used to protect the names.
+    mutable std::mutex namesMutex;
 };
 
 /// @defgroup FlagsToList Flags to List of Strings.
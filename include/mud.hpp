@@ -38,6 +38,7 @@
 #include "character/skill/skill.hpp"
 #include "updater/updater.hpp"
 #include "item/writing.hpp"
+#include "item/itemQueryIndex.hpp"
 #include "creation/material.hpp"
 #include "structure/area.hpp"
 #include "structure/room.hpp"
@@ -51,6 +52,7 @@
 #include "character/bodyPart.hpp"
 #include "structure/map_generation/heightMap.hpp"
 #include "structure/map_generation/mapWrapper.hpp"
+#include "structure/map_generation/mapGenerationJob.hpp"
 
 class Direction;
 
@@ -162,6 +164,8 @@ public:
     std::vector<Mobile *> mudMobiles;
     /// List of all items.
     std::map<int, Item *> mudItems;
+    /// Indices used to search the items.
+    ItemQueryIndex mudItemIndex;
     /// List of all the rooms.
     std::map<int, Room *> mudRooms;
     /// List all the items model.
@@ -206,6 +210,8 @@ public:
     std::map<unsigned int, std::shared_ptr<HeightMap>> mudHeightMaps;
     /// List of generated maps.
     std::map<unsigned int, std::shared_ptr<MapWrapper>> mudGeneratedMaps;
+    /// List of maps being generated in background.
+    std::map<unsigned int, std::shared_ptr<MapGenerationJob>> mudMapJobs;
 
     /// @brief Update all the player on the database.
     /// @return <b>True</b> if the operations succeeded,<br>
@@ -312,6 +318,9 @@ public:
 
     /// @brief Add a generated map.
     bool addGeneratedMap(const std::shared_ptr<MapWrapper> & mapWrapper);
+
+    /// @brief Add a map generation job.
+    bool addMapJob(const std::shared_ptr<MapGenerationJob> & mapJob);
     ///@}
 
     /// @defgroup GlobalFind Global Find Functions
@@ -400,6 +409,13 @@ public:
     ///         <b>False</b> otherwise.
     bool runMud();
 
+    /// @brief Loads the world, without accepting any connection, and runs
+    ///         the combat arena described by the given arguments.
+    /// @param args The arguments of the arena.
+    /// @return <b>True</b> if there are no errors,<br>
+    ///         <b>False</b> otherwise.
+    bool runArena(const std::vector<std::string> & args);
+
     /// @brief Activate the signal for shutting down the mud.
     void shutDownSignal();
 
@@ -434,6 +450,10 @@ public:
     /// @brief Provides an unique vnum for an area.
     int getUniqueAreaVnum() const;
 
+    /// @brief Provides an unique vnum for a generated map, which is not used
+    /// neither by the generated maps nor by the running jobs.
+    unsigned int getUniqueGeneratedMapVnum() const;
+
     /// @brief Send message to all connected players.
     /// @param level   The level of the player: 0 normal, 1 admin.
     /// @param message Message to send.
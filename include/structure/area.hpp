@@ -176,6 +176,12 @@ public:
     /// @return A vector containing all the coordinates of valid rooms.
     std::vector<Coordinates> fov(Coordinates & origin, const int & radius);
 
+    /// @brief Updates the rooms in sight of the characters which are looking
+    ///         at the given room or at its surroundings. It must be called
+    ///         when the visibility through the room changes.
+    /// @param room The room whose visibility has changed.
+    void updateSightAround(Room * room);
+
     /// @brief Determine if a coordinate is in sight from a starting one.
     /// @param source The coordinates of the origin.
     /// @param target The coordinates of the target room.
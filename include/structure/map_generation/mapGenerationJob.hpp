@@ -0,0 +1,106 @@
+/// @file   mapGenerationJob.hpp
+/// @author Enrico Fraccaroli
+/// @date   Oct 19 2026
+/// @copyright
+/// Copyright (c) 2017 Enrico Fraccaroli <enrico.fraccaroli@gmail.com>
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///     The above copyright notice and this permission notice shall be included
+///     in all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+
+
+#pragma once
+
+#include "structure/map_generation/mapGenerator.hpp"
+
+#include <thread>
+
+/// @brief The status of a map generation job.
+using MapGenerationStatus = enum class MapGenerationStatus_t
+{
+    Running,    ///< The map is being generated.
+    Completed,  ///< The map has been generated.
+    Failed,     ///< The generation has failed.
+    Cancelled   ///< The generation has been cancelled.
+};
+
+/// @brief Generates a map on a background thread.
+/// @details
+/// The generated MapWrapper is detached from the mud, so the job never
+///  touches the live world. Once the job is completed, the map is collected
+///  by the MudUpdater on the main thread.
+class MapGenerationJob
+{
+public:
+    /// The unique identifier of the job.
+    const unsigned int id;
+    /// The name of the character who started the job.
+    const std::string owner;
+
+private:
+    /// The generator.
+    MapGenerator generator;
+    /// The map being generated.
+    std::shared_ptr<MapWrapper> map;
+    /// The status of the job.
+    std::atomic<MapGenerationStatus> status;
+    /// The thread on which the map is generated.
+    std::thread worker;
+
+public:
+    /// @brief Constructor.
+    MapGenerationJob(const unsigned int & _id,
+                     const std::string & _owner,
+                     const MapGeneratorConfiguration & _configuration,
+                     const std::shared_ptr<HeightMap> & _heightMap);
+
+    /// @brief Destructor, it cancels the job and waits for the thread.
+    ~MapGenerationJob();
+
+    /// @brief Disable Copy Construct.
+    MapGenerationJob(MapGenerationJob const &) = delete;
+
+    /// @brief Disable Copy assign.
+    MapGenerationJob & operator=(MapGenerationJob const &) = delete;
+
+    /// @brief Starts the generation on the background thread.
+    void start();
+
+    /// @brief Requests the generation to stop.
+    void cancel();
+
+    /// @brief Provides the status of the job.
+    inline MapGenerationStatus getStatus() const
+    {
+        return status;
+    }
+
+    /// @brief Provides the progress of the generation, as a percentage.
+    inline unsigned int getProgress() const
+    {
+        return generator.getProgress();
+    }
+
+    /// @brief Provides the configuration, with the seed actually used.
+    inline const MapGeneratorConfiguration & getConfiguration() const
+    {
+        return generator.getConfiguration();
+    }
+
+    /// @brief Provides the generated map, once the job is completed.
+    std::shared_ptr<MapWrapper> getMap() const;
+
+    /// @brief Provides the status of the job as string.
+    std::string getStatusString() const;
+};
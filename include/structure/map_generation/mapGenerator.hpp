@@ -25,16 +25,30 @@
 #include "structure/map_generation/heightMap.hpp"
 #include "structure/map_generation/mapGeneratorConfiguration.hpp"
 
+#include <atomic>
+#include <functional>
 #include <memory>
+#include <random>
 
 /// @brief Automatic generator of maps.
 class MapGenerator
 {
 private:
+    /// The number of stages of the generation.
+    static constexpr unsigned int numStages = 7;
     /// Generator configuration.
     MapGeneratorConfiguration configuration;
     /// Height map.
     std::shared_ptr<HeightMap> heightMap;
+    /// The generator used for all the random values of the map, seeded with
+    /// the seed inside the configuration.
+    std::mt19937 generator;
+    /// The number of threads used by the parallel stages.
+    unsigned int numThreads;
+    /// The number of generation stages already completed.
+    std::atomic<unsigned int> completedStages;
+    /// When set, the generation stops at the next stage.
+    std::atomic<bool> cancelled;
 
 public:
 
@@ -45,6 +59,26 @@ public:
     /// @brief Generates a new map.
     bool generateMap(const std::shared_ptr<MapWrapper> & map);
 
+    /// @brief Provides the progress of the generation, as a percentage.
+    /// @details It can be safely called from another thread.
+    unsigned int getProgress() const;
+
+    /// @brief Requests the generation to stop at the next stage.
+    /// @details It can be safely called from another thread.
+    void cancel();
+
+    /// @brief Checks if the generation has been cancelled.
+    inline bool isCancelled() const
+    {
+        return cancelled;
+    }
+
+    /// @brief Provides the configuration, with the seed actually used.
+    inline const MapGeneratorConfiguration & getConfiguration() const
+    {
+        return configuration;
+    }
+
 private:
     /// @brief Initializes the map.
     bool initializeMap(const std::shared_ptr<MapWrapper> & map);
@@ -67,4 +101,15 @@ private:
 
     /// @brief Resets the z coordinates of the cells inside the map to 50.
     bool resetZCoordinates(const std::shared_ptr<MapWrapper> & map);
+
+    /// @brief Splits the columns [0, width) of the map in bands and runs the
+    /// given function on each band in parallel.
+    /// @param width The number of columns.
+    /// @param body  The function receiving the band [xBegin, xEnd).
+    void parallelBands(const int & width,
+                       const std::function<void(int, int)> & body) const;
+
+    /// @brief Generates a random integer between the given bounds, drawing
+    /// from the seeded generator.
+    int randomInt(const int & lowerBound, const int & upperBound);
 };
\ No newline at end of file
@@ -45,6 +45,12 @@ public:
     int numForests;
     /// The minimum distance between forests.
     int minForestDistance;
+    /// The seed used by the generator, the same seed always produces the
+    /// same map regardless of the number of threads (0 means random).
+    unsigned int seed;
+    /// The number of threads used by the parallel stages (0 means use the
+    /// hardware concurrency).
+    unsigned int numThreads;
 
     /// @brief Constructor.
     MapGeneratorConfiguration();
@@ -24,6 +24,8 @@
 #include "structure/map_generation/mapCell.hpp"
 #include <vector>
 
+class Area;
+
 /// @brief Class which contains (wrap) an under-construction map.
 class MapWrapper
 {
@@ -34,10 +36,15 @@ public:
     int width;
     /// Height of the map.
     int height;
-    /// The map.
-    std::map<int, std::map<int, MapCell>> map;
+    /// The map, stored as a dense grid indexed by (x * height + y).
+    std::vector<MapCell> map;
     /// The air map.
     std::map<int, std::map<int, std::vector<MapCell>>> airMap;
+    /// The area which is being built from the map.
+    Area * buildArea;
+    /// The number of build steps already performed, first the rooms of all
+    /// the cells are created and then their exits.
+    size_t buildCursor;
 
     /// @brief Constructor.
     MapWrapper();
@@ -45,17 +52,9 @@ public:
     /// @brief Destructor.
     ~MapWrapper();
 
-    /// @brief Allows to set the width of the map.
-    inline void setWidth(const int & _width)
-    {
-        width = _width;
-    }
-
-    /// @brief Allows to set the height of the map.
-    inline void setHeight(const int & _height)
-    {
-        height = _height;
-    }
+    /// @brief Allows to set the dimensions of the map, allocating the grid.
+    /// @details Pointers to the cells are stable until the next call.
+    void setDimensions(const int & _width, const int & _height);
 
     /// @brief Provide the width of the map.
     inline int getWidth() const
@@ -74,7 +73,7 @@ public:
     {
         if ((x < 0) || (x >= width)) return nullptr;
         if ((y < 0) || (y >= height)) return nullptr;
-        return &map[x][y];
+        return &map[static_cast<size_t>(x * height + y)];
     }
 
     /// @brief Returns the cell at the given position.
@@ -99,16 +98,8 @@ public:
     {
         if ((x < 0) || (x >= width)) return nullptr;
         if ((y < 0) || (y >= height)) return nullptr;
-        auto it = map.find(x);
-        if (it != map.end())
-        {
-            auto it2 = it->second.find(y);
-            if (it2 != it->second.end())
-            {
-                return &it2->second;
-            }
-        }
-        return nullptr;
+        if (map.empty()) return nullptr;
+        return &map[static_cast<size_t>(x * height + y)];
     }
 
     /// @brief Returns the cell at the given position.
@@ -143,7 +134,8 @@ public:
                     int y,
                     const MapCell & mapCell)
     {
-        map[x][y] = mapCell;
+        auto cell = this->getCell(x, y);
+        if (cell != nullptr) (*cell) = mapCell;
     }
 
     /// @brief Destroy the map.
@@ -152,4 +144,45 @@ public:
     /// @brief Build the map.
     bool buildMap(const std::string & mapName,
                   const std::string & builder);
+
+    /// @brief Starts building the map, by creating and adding its area to
+    /// the mud. The rooms are created by the following calls to buildStep.
+    /// @param mapName The name of the area.
+    /// @param builder The name of the builder.
+    /// @return <b>True</b> if the area has been created,<br>
+    ///         <b>False</b> otherwise.
+    bool beginBuild(const std::string & mapName,
+                    const std::string & builder);
+
+    /// @brief Performs at most the given number of build steps.
+    /// @param maxSteps The maximum number of steps.
+    /// @return <b>True</b> if the steps have been performed,<br>
+    ///         <b>False</b> otherwise.
+    bool buildStep(const size_t & maxSteps);
+
+    /// @brief Checks if the map has been completely built.
+    inline bool isBuilt() const
+    {
+        return (buildArea != nullptr) && (buildCursor >= (map.size() * 2));
+    }
+
+    /// @brief Checks if the map is being built.
+    inline bool isBuilding() const
+    {
+        return (buildArea != nullptr) && !this->isBuilt();
+    }
+
+    /// @brief Provides the progress of the build, as a percentage.
+    unsigned int getBuildProgress() const;
+
+    /// @brief Draws the map with the tiles of its cells.
+    std::string drawMap() const;
+
+private:
+    /// @brief Creates the room of the given cell.
+    bool buildRoom(MapCell * cell);
+
+    /// @brief Creates the exits between the room of the given cell and the
+    /// rooms of its neighbours.
+    bool buildExits(MapCell * cell);
 };
\ No newline at end of file
@@ -0,0 +1,103 @@
+/// @file   spatialHash.hpp
+/// @author Enrico Fraccaroli
+/// @date   Oct 19 2026
+/// @copyright
+/// Copyright (c) 2017 Enrico Fraccaroli <enrico.fraccaroli@gmail.com>
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///     The above copyright notice and this permission notice shall be included
+///     in all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+#include "structure/map_generation/mapCell.hpp"
+#include "structure/structureUtils.hpp"
+
+#include <unordered_map>
+#include <vector>
+
+/// @brief Buckets the cells of a map on the (x, y) plane, so that checking
+/// the minimum distance from the already selected cells only has to look at
+/// the nearby buckets instead of the whole selection.
+class SpatialHash
+{
+private:
+    /// The minimum distance between two cells of the hash.
+    int minDistance;
+    /// The side of each bucket.
+    int bucketSize;
+    /// The buckets.
+    std::unordered_map<long long, std::vector<MapCell *>> buckets;
+
+public:
+    /// @brief Constructor.
+    /// @param _minDistance The minimum distance between two cells.
+    explicit SpatialHash(const int & _minDistance) :
+        minDistance(std::max(_minDistance, 0)),
+        // The distance between two cells is truncated to an integer, so a
+        // cell at distance minDistance can be up to minDistance + 1 away.
+        bucketSize(std::max(_minDistance, 0) + 1),
+        buckets()
+    {
+        // Nothing to do.
+    }
+
+    /// @brief Checks if the cell is farther than the minimum distance from
+    /// every cell inside the hash.
+    bool isFarEnough(MapCell * cell) const
+    {
+        auto bx = this->getBucket(cell->coordinates.x);
+        auto by = this->getBucket(cell->coordinates.y);
+        for (auto x = bx - 1; x <= bx + 1; ++x)
+        {
+            for (auto y = by - 1; y <= by + 1; ++y)
+            {
+                auto it = buckets.find(this->getKey(x, y));
+                if (it == buckets.end()) continue;
+                for (auto point : it->second)
+                {
+                    auto distance = StructUtils::getDistance(
+                        cell->coordinates, point->coordinates);
+                    if (distance <= minDistance)
+                    {
+                        return false;
+                    }
+                }
+            }
+        }
+        return true;
+    }
+
+    /// @brief Adds the cell to the hash.
+    void add(MapCell * cell)
+    {
+        buckets[this->getKey(this->getBucket(cell->coordinates.x),
+                             this->getBucket(cell->coordinates.y))]
+            .emplace_back(cell);
+    }
+
+private:
+    /// @brief Provides the bucket of the given coordinate.
+    inline int getBucket(const int & value) const
+    {
+        return value / bucketSize;
+    }
+
+    /// @brief Provides the key of the given bucket.
+    inline long long getKey(const int & bx, const int & by) const
+    {
+        return (static_cast<long long>(bx) << 32) ^
+               static_cast<unsigned int>(by);
+    }
+};
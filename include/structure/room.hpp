@@ -32,6 +32,8 @@
 #include "character/characterVector.hpp"
 #include "item/itemVector.hpp"
 #include "structure/terrain/terrain.hpp"
+#include "utilities/keywordIndex.hpp"
+#include "item/craftingIndex.hpp"
 
 class Item;
 
@@ -75,12 +77,29 @@ public:
     /// The liquid which fills the room.
     std::pair<Liquid *, unsigned int> liquidContent;
 
+private:
+    /// Index of the characters inside the room, by their keys.
+    KeywordIndex<Character> characterIndex;
+    /// Index of the items inside the room, by their keys.
+    KeywordIndex<Item> itemIndex;
+    /// Index of the tools and of the resources inside the room.
+    CraftingIndex craftingIndex;
+    /// The characters which have this room in sight.
+    std::vector<Character *> observers;
+
+public:
     /// @brief Constructor.
     Room();
 
     /// @brief Destructor.
     virtual ~Room();
 
+    /// @brief Allocates the room inside the pool of its size.
+    static void * operator new(size_t size);
+
+    /// @brief Gives the slot of the room back to its pool.
+    static void operator delete(void * pointer, size_t size);
+
     /// @brief Function used to check the correctness of the room.
     /// @param complete If set to true, the function check if the room has
     ///                  been placed inside an area.
@@ -144,11 +163,19 @@ public:
     /// @param key    The item to search.
     /// @param number Position of the item we want to look for.
     /// @return The item, if it's in the room.
-    inline Item * findItem(std::string const & key, int & number)
+    Item * findItem(std::string const & key, int & number) const;
+
+    /// @brief Provides the index of the tools and of the resources inside
+    ///         the room.
+    inline const CraftingIndex & getCraftingIndex() const
     {
-        return ItemUtils::FindItemIn(items, key, number);
+        return craftingIndex;
     }
 
+    /// @brief Orders the items inside the room.
+    /// @param order The ordering criterion.
+    void orderItemsBy(const ItemVector::Order & order);
+
     /// @brief Search for the building in the room.
     /// @param target The building to search.
     /// @param number Position of the building we want to look for.
@@ -169,14 +196,15 @@ public:
     /// @param target    The character to search.
     /// @param number    Number of the player we are looking for.
     /// @param exceptions The list of exceptions.
+    /// @param skipMobile <b>True</b> skips mobiles.
+    /// @param skipPlayer <b>True</b> skips players.
     /// @return The character, if it's in the room.
-    inline Character * findCharacter(
+    Character * findCharacter(
         std::string const & target,
         int & number,
-        std::vector<Character *> const & exceptions = std::vector<Character *>()) const
-    {
-        return characters.findCharacter(target, number, exceptions);
-    }
+        std::vector<Character *> const & exceptions = std::vector<Character *>(),
+        bool skipMobile = false,
+        bool skipPlayer = false) const;
 
     /// @brief Search for the player in the room.
     /// @param target    The player to search.
@@ -264,6 +292,41 @@ public:
         funcSendToAll(StringBuilder::build(message, args...), checkException);
     }
 
+    /// @brief Subscribes the given character as observer of the room.
+    /// @param character The character which has the room in sight.
+    void addObserver(Character * character);
+
+    /// @brief Unsubscribes the given character from the observers.
+    /// @param character The character which lost sight of the room.
+    void removeObserver(Character * character);
+
+    /// @brief Provides the characters which have the room in sight.
+    inline const std::vector<Character *> & getObservers() const
+    {
+        return observers;
+    }
+
+    /// @brief Sends a message to all the characters which have the room in
+    ///         sight, including the ones inside it.
+    /// @param message        The message to send.
+    /// @param checkException The checking function.
+    void funcSendToObservers(const std::string & message,
+                             std::function<bool(Character * character)> checkException);
+
+    /// @brief Sends a message to all the characters which have the room in
+    ///         sight and pass the checking function.
+    /// @param message        The message to send.
+    /// @param checkException The checking function.
+    /// @param args           The rest of the arguments.
+    template<typename ... Args>
+    void funcSendToObservers(const std::string & message,
+                             std::function<bool(Character * character)> checkException,
+                             const Args & ... args)
+    {
+        funcSendToObservers(StringBuilder::build(message, args...),
+                            checkException);
+    }
+
     /// @brief Define operator lesser than.
     /// @param right The comparison room.
     /// @return <b>True</b> if the room vnum is lesser than the other,<br>
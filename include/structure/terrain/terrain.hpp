@@ -25,6 +25,7 @@
 #include <string>
 #include <lua.hpp>
 #include <vector>
+#include <random>
 
 class Liquid;
 
@@ -87,6 +88,7 @@ public:
     void addLiquidSource(Liquid * _liquid,
                          const unsigned int & _assignedProbability);
 
-    /// @brief Provides a random liquid source based on their probabilities.
-    Liquid * getRandomLiquidSource() const;
+    /// @brief Provides a random liquid source based on their probabilities,
+    /// drawing from the given generator.
+    Liquid * getRandomLiquidSource(std::mt19937 & generator) const;
 };
@@ -0,0 +1,219 @@
+/// @file   tickProfiler.hpp
+/// @brief  Define the profiler of the mud cycles.
+/// @author Enrico Fraccaroli
+/// @date   Oct 19 2026
+/// @copyright
+/// Copyright (c) 2016 Enrico Fraccaroli <enrico.fraccaroli@gmail.com>
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///     The above copyright notice and this permission notice shall be included
+///     in all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <deque>
+#include <map>
+#include <string>
+
+#include "utilities/stopwatch.hpp"
+
+/// @brief Enumerator which identifies the phases of a mud cycle.
+using TickPhase = enum class TickPhase_t
+{
+    Characters,         ///< TIC update of the characters.
+    Items,              ///< TIC update of the items.
+    Hour,               ///< Hourly update of characters and items.
+    Actions,            ///< Execution of the pending actions.
+    MapGeneration,      ///< Collection and build of the generated maps.
+    ItemDestruction,    ///< Destruction of the broken items.
+    InactivePlayers,    ///< Removal of the inactive players.
+    Select,             ///< Wait for the activity on the sockets.
+    Accept,             ///< Acceptance of the new connections.
+    Read,               ///< Input of the players, commands included.
+    Write,              ///< Output to the players.
+};
+
+/// @brief Collects the timings of the phases of each mud cycle and of the
+///         commands, and reports the cycles which exceed the budget.
+class TickProfiler
+{
+public:
+    /// The number of phases.
+    static constexpr size_t numPhases = static_cast<size_t>(TickPhase::Write) + 1;
+    /// The number of buckets of the command histograms.
+    static constexpr size_t numBuckets = 6;
+    /// The number of slow cycles which are kept.
+    static constexpr size_t maxSlowTicks = 16;
+
+    /// @brief The timings of a phase, in microseconds.
+    struct PhaseStats
+    {
+        /// The total time spent in the phase.
+        double total;
+        /// The longest time spent in the phase during a cycle.
+        double max;
+    };
+
+    /// @brief The timings of a command, in microseconds.
+    struct CommandStats
+    {
+        /// The number of executions.
+        unsigned long count;
+        /// The total execution time.
+        double total;
+        /// The longest execution time.
+        double max;
+        /// The number of executions which fall inside each bucket.
+        std::array<unsigned long, numBuckets> buckets;
+    };
+
+    /// @brief The timings of a cycle which exceeded the budget.
+    struct SlowTick
+    {
+        /// When the cycle ended.
+        std::string time;
+        /// The duration of the cycle, in microseconds.
+        double duration;
+        /// The time spent in each phase, in microseconds.
+        std::array<double, numPhases> phases;
+    };
+
+private:
+    /// The beginning of the current cycle.
+    Stopwatch<std::chrono::microseconds> tickStopwatch;
+    /// The time spent in each phase during the current cycle.
+    std::array<double, numPhases> currentPhases;
+    /// The timings of each phase.
+    std::array<PhaseStats, numPhases> phases;
+    /// The timings of the commands, by name.
+    std::map<std::string, CommandStats> commands;
+    /// The most recent cycles which exceeded the budget.
+    std::deque<SlowTick> slowTicks;
+    /// The number of profiled cycles.
+    unsigned long ticks;
+    /// The total duration of the profiled cycles, in microseconds.
+    double ticksTotal;
+    /// The duration of the longest cycle, in microseconds.
+    double ticksMax;
+    /// The maximum duration of a cycle, in microseconds.
+    double budget;
+
+    /// @brief Constructor.
+    TickProfiler();
+
+    /// @brief Destructor.
+    ~TickProfiler();
+
+public:
+    /// @brief Disable Copy Construct.
+    TickProfiler(TickProfiler const &) = delete;
+
+    /// @brief Disable Move construct.
+    TickProfiler(TickProfiler &&) = delete;
+
+    /// @brief Disable Copy assign.
+    TickProfiler & operator=(TickProfiler const &) = delete;
+
+    /// @brief Disable Move assign.
+    TickProfiler & operator=(TickProfiler &&) = delete;
+
+    /// @brief Get the singleton istance of the TickProfiler.
+    /// @return The static and uniquie TickProfiler variable.
+    static TickProfiler & instance();
+
+    /// @brief Marks the beginning of a mud cycle.
+    void beginTick();
+
+    /// @brief Marks the end of a mud cycle, logging it if it has exceeded
+    ///         the budget.
+    /// @details
+    /// The time spent waiting inside select is not part of the work done by
+    ///  the cycle, thus it is not counted against the budget.
+    void endTick();
+
+    /// @brief Adds the given time to a phase of the current cycle.
+    void addPhaseTime(const TickPhase & phase, const double & elapsed);
+
+    /// @brief Adds an execution of the given command.
+    void addCommandTime(const std::string & name, const double & elapsed);
+
+    /// @brief Sets the maximum duration of a cycle, in milliseconds.
+    void setBudget(const double & milliseconds);
+
+    /// @brief Provides the maximum duration of a cycle, in milliseconds.
+    double getBudget() const;
+
+    /// @brief Clears all the collected timings.
+    void reset();
+
+    /// @brief Provides the number of profiled cycles.
+    inline unsigned long getTicks() const
+    {
+        return ticks;
+    }
+
+    /// @brief Provides the average duration of a cycle, in microseconds.
+    double getAverageTick() const;
+
+    /// @brief Provides the duration of the longest cycle, in microseconds.
+    inline double getMaxTick() const
+    {
+        return ticksMax;
+    }
+
+    /// @brief Provides the timings of the given phase.
+    const PhaseStats & getPhaseStats(const TickPhase & phase) const;
+
+    /// @brief Provides the timings of the commands.
+    inline const std::map<std::string, CommandStats> & getCommandStats() const
+    {
+        return commands;
+    }
+
+    /// @brief Provides the most recent cycles which exceeded the budget.
+    inline const std::deque<SlowTick> & getSlowTicks() const
+    {
+        return slowTicks;
+    }
+
+    /// @brief Provides the name of the given phase.
+    static std::string phaseToString(const TickPhase & phase);
+
+    /// @brief Provides the upper limit of the given bucket.
+    static std::string bucketToString(const size_t & bucket);
+
+    /// @brief Provides the time spent in each phase in a single line.
+    static std::string phasesToString(
+        const std::array<double, numPhases> & timings);
+};
+
+/// @brief Adds the time elapsed between its construction and its destruction
+///         to the given phase of the current cycle.
+class ProfilePhase
+{
+private:
+    /// The profiled phase.
+    TickPhase phase;
+    /// The stopwatch.
+    Stopwatch<std::chrono::microseconds> stopwatch;
+
+public:
+    /// @brief Constructor.
+    explicit ProfilePhase(const TickPhase & _phase);
+
+    /// @brief Destructor.
+    ~ProfilePhase();
+};
@@ -24,10 +24,16 @@
 
 #include <chrono>
 #include <list>
+#include <map>
+#include <vector>
+
+#include "utilities/workerPool.hpp"
 
 // Forward declarations.
 class Item;
 
+class Character;
+
 class Room;
 
 /// @brief Enumerator which identifies the day phase.
@@ -68,6 +74,19 @@ private:
     /// Mud current day phase.
     DayPhase mudDayPhase;
 
+    /// The maximum number of build steps performed on the generated maps at
+    /// each cycle of the mud.
+    const size_t mapBuildSteps;
+
+    /// The threads which execute the compute phase of the TICs and hours.
+    WorkerPool workerPool;
+
+    /// The items which have to be updated at each TIC, by vnum.
+    std::map<int, Item *> tickingItems;
+    /// The items which decay at each hour, by vnum. Since corpses have
+    /// negative vnums, they come before the other items.
+    std::map<int, Item *> decayingItems;
+
     // Garbage collection structures.
     /// List of item that has to be descroyed at the end of the mud cycle.
     std::list<Item *> itemToDestroy;
@@ -104,6 +123,21 @@ public:
     /// @brief Update uncompressed bandwidth.
     void updateBandUncompressed(const size_t & size);
 
+    /// @brief Adds the item to the sets of items which are updated with the
+    /// passing of time, if it has a time-dependent state. It must be called
+    /// again whenever the item starts having one (e.g. a light is lit).
+    void registerItem(Item * item);
+
+    /// @brief Removes the item from the sets of items which are updated with
+    /// the passing of time.
+    void unregisterItem(Item * item);
+
+    /// @brief Provides the number of items updated at each TIC.
+    size_t getTickingItemsCount() const;
+
+    /// @brief Provides the number of items which decay at each hour.
+    size_t getDecayingItemsCount() const;
+
     /// @brief Add the item to the list of items that will be destroyed at
     /// the end of the MUD TIC.
     void addItemToDestroy(Item * item);
@@ -145,4 +179,18 @@ private:
 
     /// @brief Perform pending actions.
     void performActions();
+
+    /// @brief Updates the characters at each TIC. The changes to the state
+    ///         of each character are computed in parallel, then the ones
+    ///         which involve the rest of the mud are applied serially.
+    void updateCharactersTic();
+
+    /// @brief Let the given items decay. The decay is computed in parallel,
+    ///         then the broken items are emptied and scheduled for
+    ///         destruction serially, in the given order.
+    void updateItemsDecay(const std::vector<Item *> & items);
+
+    /// @brief Collects the completed map generation jobs and advances the
+    /// build of the generated maps.
+    void updateMapGeneration();
 };
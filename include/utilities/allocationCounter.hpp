@@ -0,0 +1,41 @@
+/// @file   allocationCounter.hpp
+/// @brief  Define the functions used to count the allocations.
+/// @author Enrico Fraccaroli
+/// @date   Oct 19 2026
+/// @copyright
+/// Copyright (c) 2016 Enrico Fraccaroli <enrico.fraccaroli@gmail.com>
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///     The above copyright notice and this permission notice shall be included
+///     in all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+
+
+#pragma once
+
+/// @brief Counts the dynamic allocations performed by each thread.
+/// @details
+/// The counting is done by replacing the global operator new, which is done
+///  only when the mud is built with RADMUD_COUNT_ALLOCATIONS (see the
+///  COUNT_ALLOCATIONS option of CMake), since it adds a cost to every
+///  allocation.
+class AllocationCounter
+{
+public:
+    /// @brief Checks if the allocations are being counted.
+    static bool isEnabled();
+
+    /// @brief Provides the number of allocations performed so far by the
+    ///         calling thread, or 0 if they are not being counted.
+    static unsigned long getCount();
+};
@@ -0,0 +1,153 @@
+/// @file   keywordIndex.hpp
+/// @brief  Define the class KeywordIndex.
+/// @author Enrico Fraccaroli
+/// @date   Oct 19 2026
+/// @copyright
+/// Copyright (c) 2016 Enrico Fraccaroli <enrico.fraccaroli@gmail.com>
+/// Permission to use, copy, modify, and distribute this software for any
+/// purpose with or without fee is hereby granted, provided that the above
+/// copyright notice and this permission notice appear in all copies.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+/// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+/// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+/// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+/// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+/// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+/// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#pragma once
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/// @brief Prefix-searchable index which maps keywords to elements.
+/// @details
+/// The elements are returned in the same order in which they have been
+///  added, so that the "2.sword" kind of targeting keeps selecting the same
+///  element it would select by scanning the container.
+template<typename T>
+class KeywordIndex
+{
+private:
+    /// The information stored for each indexed element.
+    struct Entry
+    {
+        /// The insertion order of the element.
+        unsigned long sequence;
+        /// The keywords of the element.
+        std::vector<std::string> keys;
+    };
+
+    /// The keywords, sorted so that the ones sharing a prefix are adjacent.
+    std::multimap<std::string, T *> keywords;
+    /// The indexed elements.
+    std::unordered_map<T *, Entry> entries;
+    /// The insertion order of the next element.
+    unsigned long nextSequence;
+
+public:
+    /// @brief Constructor.
+    KeywordIndex() :
+        keywords(),
+        entries(),
+        nextSequence()
+    {
+        // Nothing to do.
+    }
+
+    /// @brief Adds the element with the given keywords to the index.
+    /// @details If the element is already indexed, nothing is done.
+    void add(T * element, const std::vector<std::string> & keys)
+    {
+        if (entries.find(element) != entries.end())
+        {
+            return;
+        }
+        for (auto const & key : keys)
+        {
+            keywords.emplace(key, element);
+        }
+        entries.emplace(element, Entry{nextSequence++, keys});
+    }
+
+    /// @brief Removes the element from the index.
+    void remove(T * element)
+    {
+        auto entry = entries.find(element);
+        if (entry == entries.end())
+        {
+            return;
+        }
+        for (auto const & key : entry->second.keys)
+        {
+            auto range = keywords.equal_range(key);
+            for (auto it = range.first; it != range.second; ++it)
+            {
+                if (it->second == element)
+                {
+                    keywords.erase(it);
+                    break;
+                }
+            }
+        }
+        entries.erase(entry);
+    }
+
+    /// @brief Updates the insertion order of the elements, so that it
+    /// follows the order of the given container.
+    void reorder(const std::vector<T *> & container)
+    {
+        unsigned long sequence = 0;
+        for (auto element : container)
+        {
+            auto entry = entries.find(element);
+            if (entry != entries.end())
+            {
+                entry->second.sequence = sequence++;
+            }
+        }
+        nextSequence = sequence;
+    }
+
+    /// @brief Checks if the element is indexed.
+    inline bool contains(T * element) const
+    {
+        return entries.find(element) != entries.end();
+    }
+
+    /// @brief Provides the number of indexed elements.
+    inline size_t size() const
+    {
+        return entries.size();
+    }
+
+    /// @brief Provides the elements with at least a keyword beginning with
+    /// the given prefix, in the order in which they have been added.
+    std::vector<T *> find(const std::string & prefix) const
+    {
+        std::vector<std::pair<unsigned long, T *>> found;
+        for (auto it = keywords.lower_bound(prefix); it != keywords.end(); ++it)
+        {
+            if (it->first.compare(0, prefix.size(), prefix) != 0)
+            {
+                break;
+            }
+            found.emplace_back(entries.at(it->second).sequence, it->second);
+        }
+        // Order them by insertion and drop the elements matched by more than
+        // one keyword.
+        std::sort(found.begin(), found.end());
+        found.erase(std::unique(found.begin(), found.end()), found.end());
+        std::vector<T *> elements;
+        elements.reserve(found.size());
+        for (auto const & it : found)
+        {
+            elements.emplace_back(it.second);
+        }
+        return elements;
+    }
+};
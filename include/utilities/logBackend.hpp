@@ -0,0 +1,194 @@
+/// @file   logBackend.hpp
+/// @brief  Define the asynchronous backend of the logger.
+/// @author Enrico Fraccaroli
+/// @date   Oct 19 2026
+/// @copyright
+/// Copyright (c) 2016 Enrico Fraccaroli <enrico.fraccaroli@gmail.com>
+/// Permission to use, copy, modify, and distribute this software for any
+/// purpose with or without fee is hereby granted, provided that the above
+/// copyright notice and this permission notice appear in all copies.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+/// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+/// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+/// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+/// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+/// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+/// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <ctime>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "utilities/logIndex.hpp"
+
+// Forward declarations.
+enum class LogLevel_t;
+
+/// @brief An entry of the log.
+struct LogEntry
+{
+    /// The global order of the entry.
+    unsigned long sequence;
+    /// The level of the entry.
+    LogLevel_t level;
+    /// The thread which has logged the entry.
+    std::thread::id thread;
+    /// When the entry has been logged.
+    time_t time;
+    /// The logged message.
+    std::string message;
+};
+
+/// @brief A lock-free ring of entries, written by a single thread and read
+///         by the writer of the log.
+class LogRing
+{
+private:
+    /// The slots of the ring.
+    std::vector<LogEntry> slots;
+    /// The next slot to read.
+    std::atomic<size_t> head;
+    /// The next slot to write.
+    std::atomic<size_t> tail;
+
+public:
+    /// Set when the thread which writes the ring has terminated.
+    std::atomic<bool> closed;
+
+    /// @brief Constructor.
+    /// @param capacity The number of slots of the ring.
+    explicit LogRing(const size_t & capacity);
+
+    /// @brief Moves the entry inside the ring.
+    /// @return <b>True</b> if there was room for the entry,<br>
+    ///         <b>False</b> otherwise.
+    bool push(LogEntry & entry);
+
+    /// @brief Moves the oldest entry of the ring inside the given one.
+    /// @return <b>True</b> if there was an entry,<br>
+    ///         <b>False</b> otherwise.
+    bool pop(LogEntry & entry);
+
+    /// @brief Provides the number of entries inside the ring.
+    size_t size() const;
+
+    /// @brief Provides the number of slots of the ring.
+    inline size_t capacity() const
+    {
+        return slots.size() - 1;
+    }
+};
+
+/// @brief Collects the entries logged by each thread inside its own ring, and
+///         writes them in batches from a background thread.
+/// @details
+/// The backend is never destroyed, so that it can still be used while the
+///  static objects are being destroyed. At exit the writer is stopped and
+///  the entries are written synchronously.
+class LogBackend
+{
+private:
+    /// The number of slots of each ring.
+    static constexpr size_t ringCapacity = 4096;
+
+    /// The log file.
+    std::fstream stream;
+    /// Protects the log file and the output streams.
+    std::mutex streamMutex;
+    /// The size of the log file.
+    std::streamoff fileSize;
+    /// The index of the log.
+    LogIndex index;
+    /// The rings of the threads.
+    std::vector<std::shared_ptr<LogRing>> rings;
+    /// Protects the list of rings.
+    std::mutex ringsMutex;
+    /// The sequence number of the next entry.
+    std::atomic<unsigned long> sequence;
+    /// The number of entries dropped because their ring was full.
+    std::atomic<unsigned long> dropped;
+    /// The number of dropped entries already reported inside the log.
+    unsigned long reportedDrops;
+    /// Protects the state of the writer.
+    std::mutex writerMutex;
+    /// Used to wake up the writer.
+    std::condition_variable wakeUp;
+    /// Used to notify the completion of a flush.
+    std::condition_variable flushed;
+    /// The number of requested flushes.
+    unsigned long flushRequested;
+    /// The number of completed flushes.
+    unsigned long flushCompleted;
+    /// Tells the writer to terminate.
+    bool stopping;
+    /// If the writer is running.
+    std::atomic<bool> running;
+    /// The background writer.
+    std::thread writer;
+
+    /// @brief Constructor.
+    LogBackend();
+
+    /// @brief Destructor.
+    ~LogBackend();
+
+public:
+    /// @brief Disable Copy Construct.
+    LogBackend(LogBackend const &) = delete;
+
+    /// @brief Disable Copy assign.
+    LogBackend & operator=(LogBackend const &) = delete;
+
+    /// @brief Get the singleton istance of the LogBackend.
+    static LogBackend & instance();
+
+    /// @brief Opens the log file.
+    bool open(const std::string & filename);
+
+    /// @brief Adds an entry to the log.
+    void push(const LogLevel_t & level, std::string message);
+
+    /// @brief Waits until all the entries logged so far have been written.
+    void flush();
+
+    /// @brief Stops the writer, from now on the entries are written
+    ///         synchronously.
+    void stop();
+
+    /// @brief Provides the number of entries dropped so far.
+    unsigned long getDropped() const;
+
+    /// @brief Provides the index of the log.
+    inline const LogIndex & getIndex() const
+    {
+        return index;
+    }
+
+private:
+    /// @brief Provides the ring of the calling thread, or nullptr if the
+    ///         thread is terminating.
+    LogRing * getLocalRing();
+
+    /// @brief The loop of the writer.
+    void writerLoop();
+
+    /// @brief Moves the entries from the rings to the batch, sorted by
+    ///         sequence.
+    void drain(std::vector<LogEntry> & batch);
+
+    /// @brief Writes the batch of entries on the log file and on the output
+    ///         streams, and adds them to the index.
+    void write(const std::vector<LogEntry> & batch);
+
+    /// @brief Formats the entry as a line of the log.
+    static std::string format(const LogEntry & entry);
+};
@@ -0,0 +1,162 @@
+/// @file   logIndex.hpp
+/// @brief  Define the index used to search the log.
+/// @author Enrico Fraccaroli
+/// @date   Oct 19 2026
+/// @copyright
+/// Copyright (c) 2016 Enrico Fraccaroli <enrico.fraccaroli@gmail.com>
+/// Permission to use, copy, modify, and distribute this software for any
+/// purpose with or without fee is hereby granted, provided that the above
+/// copyright notice and this permission notice appear in all copies.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+/// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+/// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+/// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+/// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+/// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+/// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#pragma once
+
+#include <array>
+#include <ctime>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Forward declarations.
+enum class LogLevel_t;
+
+/// @brief A line of the log kept in memory.
+struct LogRecord
+{
+    /// The number of the record since the log has been opened.
+    unsigned long number;
+    /// When the record has been logged.
+    time_t time;
+    /// The level of the record.
+    LogLevel_t level;
+    /// The formatted line.
+    std::string line;
+};
+
+/// @brief A contiguous portion of the log file.
+struct LogSegment
+{
+    /// The position of the segment inside the log file.
+    std::streamoff offset;
+    /// The length in bytes of the segment.
+    std::streamoff length;
+    /// When the first record of the segment has been logged.
+    time_t firstTime;
+    /// When the last record of the segment has been logged.
+    time_t lastTime;
+    /// The mask of the levels contained inside the segment.
+    unsigned int levels;
+    /// The number of the first record of the segment, zero for the segments
+    ///  written before the log has been opened.
+    unsigned long firstNumber;
+    /// The number of the last record of the segment, zero for the segments
+    ///  written before the log has been opened.
+    unsigned long lastNumber;
+};
+
+/// @brief Keeps the most recent records of the log in memory, indexed by
+///         level, and an index of the segments of the log file for the older
+///         ones.
+/// @details
+/// The oldest records are evicted from memory as soon as there are more than
+///  memoryCapacity of them. The records of a segment are numbered
+///  contiguously, so when a segment is only partially in memory, only its
+///  records older than the ones in memory are read from disk. The index of
+///  the segments is saved next to the log file, so that the segments written
+///  by a previous run can be searched too.
+class LogIndex
+{
+private:
+    /// The number of records kept in memory.
+    static constexpr size_t memoryCapacity = 4096;
+    /// The number of records of each segment.
+    static constexpr size_t segmentCapacity = 1024;
+    /// The number of levels.
+    static constexpr size_t numLevels = 7;
+
+    /// Protects the index.
+    mutable std::mutex indexMutex;
+    /// The path of the log file.
+    std::string logFilename;
+    /// The path of the file containing the index of the segments.
+    std::string indexFilename;
+    /// The most recent records.
+    std::deque<LogRecord> records;
+    /// For each level, the numbers of the records in memory.
+    std::array<std::deque<unsigned long>, numLevels> byLevel;
+    /// The closed segments of the log file.
+    std::vector<LogSegment> segments;
+    /// The segment which is being written.
+    LogSegment current;
+    /// The number of records of the segment which is being written.
+    size_t currentSize;
+    /// The number of the next record.
+    unsigned long nextNumber;
+
+public:
+    /// @brief Constructor.
+    LogIndex();
+
+    /// @brief Loads the index of the segments of the given log file.
+    /// @param filename The log file.
+    /// @param size     The current size of the log file.
+    void open(const std::string & filename, const std::streamoff & size);
+
+    /// @brief Adds a record to the index.
+    /// @param time   When the record has been logged.
+    /// @param level  The level of the record.
+    /// @param line   The formatted line.
+    /// @param offset The position of the line inside the log file, or -1 if
+    ///                it has not been written on file.
+    void add(const time_t & time,
+             const LogLevel_t & level,
+             const std::string & line,
+             const std::streamoff & offset);
+
+    /// @brief Searches the most recent lines of the given level.
+    /// @param level    The level of the lines.
+    /// @param since    The lines logged before this time are skipped.
+    /// @param maxLines The maximum number of lines.
+    /// @param result   The lines, from the oldest to the most recent.
+    /// @return <b>True</b> if the log has been searched,<br>
+    ///         <b>False</b> otherwise.
+    bool search(const LogLevel_t & level,
+                const time_t & since,
+                const size_t & maxLines,
+                std::string * result) const;
+
+private:
+    /// @brief Provides the position of the level inside byLevel.
+    static size_t levelToIndex(const LogLevel_t & level);
+
+    /// @brief Closes the current segment and saves it inside the index file.
+    void closeSegment();
+
+    /// @brief Evicts from memory the oldest records, when there are too
+    ///         many records.
+    void evictRecords();
+
+    /// @brief Reads from the log file the lines of the given segment which
+    ///         have the given level.
+    /// @param file     The log file.
+    /// @param segment  The segment to read.
+    /// @param levelTag The tag of the level inside the lines.
+    /// @param since    The lines logged before this time are skipped.
+    /// @param limit    The number of records of the segment to read.
+    /// @param lines    Where the lines are appended.
+    static void readSegment(std::ifstream & file,
+                            const LogSegment & segment,
+                            const std::string & levelTag,
+                            const time_t & since,
+                            const size_t & limit,
+                            std::vector<std::string> & lines);
+};
@@ -18,11 +18,18 @@
 
 #pragma once
 
+#include <atomic>
 #include <iostream>
 #include <fstream>
 
 #include "utilities/stringBuilder.hpp"
 
+/// The logging levels which are removed at compile time, as a mask of
+///  LogLevel values (e.g. 6 removes both Trace and Debug).
+#ifndef RADMUD_LOG_DISABLED_LEVELS
+#define RADMUD_LOG_DISABLED_LEVELS 0
+#endif
+
 /// @brief Enumerator which identifies the severity of the log entry.
 using LogLevel = enum class LogLevel_t
 {
@@ -38,6 +45,8 @@ using LogLevel = enum class LogLevel_t
 /// @brief Class used to handle mud logging.
 class Logger
 {
+    friend class LogBackend;
+
 private:
     /// @brief Constructor.
     Logger();
@@ -68,19 +77,59 @@ public:
     ///         <b>False</b> otherwise.
     static bool openLog(const std::string & filename);
 
-    /// @brief Retrieve the log and select only the line of the given logging level.
-    /// @param level  The category of the message.
-    /// @param result For efficiency, receive a reference to the result.
+    /// @brief Retrieve the most recent lines of the given logging level.
+    /// @details
+    /// The recent lines are kept in memory, the older ones are read only
+    ///  from the indexed segments of the log file which contain the level.
+    /// @param level    The category of the message.
+    /// @param result   For efficiency, receive a reference to the result.
+    /// @param maxLines The maximum number of lines.
+    /// @param since    The lines logged before this time are skipped.
     /// @return <b>True</b> if the log has been retrieved,<br>
     ///         <b>False</b> otherwise.
-    static bool getLog(const LogLevel & level, std::string * result);
+    static bool getLog(const LogLevel & level,
+                       std::string * result,
+                       const size_t & maxLines = 100,
+                       const time_t & since = 0);
+
+    /// @brief Converts a logging level to the curresponding string.
+    /// @param level The level to transform into string.
+    /// @return Logging level string.
+    static std::string levelToString(const LogLevel & level);
 
     /// @brief Casts an unsigned int to a possible logging level.
     /// @param level  The logging level.
     /// @return The enum which identifies the given logging level.
     static LogLevel castFromInt(const unsigned int & level);
 
+    /// @brief Checks if the messages of the given level are logged.
+    /// @param level The logging level.
+    /// @return <b>True</b> if the level is enabled,<br>
+    ///         <b>False</b> otherwise.
+    static inline bool isEnabled(const LogLevel & level)
+    {
+        auto flag = static_cast<unsigned int>(level);
+        if ((RADMUD_LOG_DISABLED_LEVELS & flag) != 0)
+        {
+            return false;
+        }
+        return (getEnabledLevels().load(std::memory_order_relaxed) & flag) != 0;
+    }
+
+    /// @brief Enables or disables at runtime the given logging level.
+    /// @param level   The logging level.
+    /// @param enabled If the level should be logged.
+    static void setLevelEnabled(const LogLevel & level, const bool & enabled);
+
+    /// @brief Provides the number of messages dropped because they were
+    ///         logged faster than they could be written.
+    static unsigned long getDroppedCount();
+
+    /// @brief Waits until all the messages logged so far have been written.
+    static void flush();
+
     /// @brief Print to consol and to logging file the given string.
+    /// @details The message is queued and written by a background thread.
     /// @param level  The category of the message.
     /// @param msg    The message to log.
     static void log(const LogLevel & level, const std::string & msg);
@@ -94,25 +143,20 @@ public:
                     const std::string & msg,
                     const Args & ... args)
     {
+        // Skip the formatting of the messages which are not logged.
+        if (!isEnabled(level))
+        {
+            return;
+        }
         log(level, StringBuilder::build(msg, args ...));
     }
 
 private:
-    /// @brief Provide the logging stream.
-    /// @return A static std::fstream, which initially <b>is not opened</b>.
-    static std::fstream & getStream();
-
-    /// @brief Return the current timestamp as "Hours:Minute".
-    /// @return The current timestamp.
-    static std::string getDateTime();
+    /// @brief Provides the mask of the levels enabled at runtime.
+    static std::atomic<unsigned int> & getEnabledLevels();
 
     /// @brief Given a logging level returns the associated output stream.
     /// @param level The level of the output stream.
     /// @return The output stream.
     static std::ostream & getOutputStream(const LogLevel & level);
-
-    /// @brief Converts a logging level to the curresponding string.
-    /// @param level The level to transform into string.
-    /// @return Logging level string.
-    static std::string levelToString(const LogLevel & level);
 };
@@ -7,13 +7,13 @@
 /// @see http://www.rinkworks.com/namegen/
 ///
 /// @example
-/// NameGen::Generator generator("sV'i");
-/// generator.toString();  // Emits a new name on each call
+/// auto pattern = namegen::CompiledPattern::get("sV'i");
+/// pattern->toString();  // Emits a new name on each call
 /// // => "entheu'loaf"
 ///
 /// ## Pattern Syntax
 ///
-///   The compile() function creates a name generator based on an input
+///   The CompiledPattern class creates a name generator based on an input
 /// pattern. The letters s, v, V, c, B, C, i, m, M, D, and d represent
 /// different types of random replacements. Everything else is emitted
 /// literally.
@@ -55,227 +55,126 @@
 ///
 /// ## Internals
 ///
-///   A name generator is anything with a toString() method, including,
-/// importantly, strings themselves. The generator constructors
-/// (Random, Sequence) perform additional optimizations when *not* used
-/// with the `new` keyword: they may pass through a provided generator,
-/// combine provided generators, or even return a simple string.
+///   CompiledPattern parses the pattern into a flat list of nodes, which is
+/// walked to append the names directly into a buffer. The compiled patterns
+/// are cached, so the same pattern is parsed only once.
 ///
-///   New pattern symbols added to Generator.symbols will automatically
-/// be used by the compiler.
+///   New pattern symbols added to the symbol map will automatically be used
+/// by the compiler.
 
 #pragma once
 
 #include <stddef.h>       // for size_t
-#include <iosfwd>         // for wstring
-#include <memory>         // for unique_ptr
-#include <stack>          // for stack
+#include <memory>         // for shared_ptr
 #include <string>         // for string
 #include <unordered_map>  // for unordered_map
+#include <unordered_set>  // for unordered_set
 #include <vector>         // for vector
 
 /// @brief Contains the classes used to generate a random name from a pattern.
 namespace namegen
 {
 
-/// @brief Used to generate random names given a pattern.
-class NameGenerator
+/// @brief A pattern compiled into a flat list of nodes.
+class CompiledPattern
 {
 public:
-    /// @brief Constructor.
-    NameGenerator();
+    /// The maximum number of patterns kept in the cache.
+    static const size_t MaxCachedPatterns = 256;
 
-    /// @brief Constructor.
-    NameGenerator(const std::string & pattern, bool collapse_triples = true);
+    /// @brief Constructor, which compiles the pattern.
+    /// @throw std::invalid_argument If the pattern is malformed.
+    CompiledPattern(const std::string & pattern, bool collapse_triples = true);
 
-    /// @brief Constructor.
-    NameGenerator(std::vector<std::unique_ptr<NameGenerator>> && _generators);
-
-    /// @brief Destructor.
-    virtual ~NameGenerator() = default;
+    /// @brief Provides the compiled pattern, compiling it only the first
+    ///         time it is requested.
+    /// @throw std::invalid_argument If the pattern is malformed.
+    static std::shared_ptr<const CompiledPattern> get(
+        const std::string & pattern);
 
     /// @brief Returns the total number of combinations.
-    virtual size_t combinations();
-
-    /// @brief Returns the minimum length of the generated name.
-    virtual size_t min();
-
-    /// @brief Returns the maximum length of the generated name.
-    virtual size_t max();
+    size_t combinations() const;
+
+    /// @brief Appends a new name to the buffer.
+    void generate(std::string & buffer) const;
+
+    /// @brief Appends the given amount of names to the buffer, followed
+    ///         by the separator.
+    void generate(std::string & buffer, size_t amount, char separator) const;
+
+    /// @brief Generates names which are not among the taken ones.
+    /// @param amount   The number of names to generate.
+    /// @param taken    The names already taken, in lower case. The new
+    ///                  names are added to them.
+    /// @param attempts The maximum number of names to try.
+    /// @return The names, which may be less than the requested ones if the
+    ///          attempts run out.
+    std::vector<std::string> generateUnique(
+        size_t amount,
+        std::unordered_set<std::string> & taken,
+        size_t attempts) const;
 
     /// @brief Prints the generated name.
-    virtual std::string toString();
-
-    /// @brief Adds a new generator to the list of generators.
-    void add(std::unique_ptr<NameGenerator> && g);
-
-protected:
-    /// The internal list of generators.
-    std::vector<std::unique_ptr<NameGenerator>> generators;
-
-    /// The type of the map of symbols.
-    using SymbolMap = std::unordered_map<std::string, const std::vector<std::string>>;
-
-    /// @brief Returns the symbol map.
-    static const SymbolMap & getSymbolMap();
+    std::string toString() const;
 
 private:
-
-    /// Allows to manipulate an element.
-    using Manipulator = enum class Manipulators
+    /// The operations performed by the nodes.
+    enum class Operation : unsigned char
     {
-        None,       ///< No manipulation
-        Capitalize, ///< Capitalize the next element.
-        Reverse     ///< Reverse the next element.
+        Literal,    ///< Emits a slice of the literals.
+        Sequence,   ///< Emits all the children.
+        Random,     ///< Emits one of the children.
+        Capitalize, ///< Capitalizes the output of the child.
+        Reverse,    ///< Reverses the output of the child.
+        Collapse    ///< Collapses the triples in the output of the child.
     };
 
-    /// Determines the type of a group of letters.
-    using GroupType = enum class GroupTypes
+    /// A node of the pattern.
+    struct Node
     {
-        None,       ///< No manipulation
-        Symbol,     ///< Capitalize the next element.
-        Literal     ///< Reverse the next element.
+        /// The operation of the node.
+        Operation operation;
+        /// The first literal or child, or the child of the manipulators.
+        unsigned int first;
+        /// The number of literals or children.
+        unsigned int count;
     };
 
-    /// @brief Class used to group letters.
-    class Group
-    {
-    public:
-        /// @brief The type of the group.
-        GroupType groupType;
-
-        /// @brief Constructor.
-        Group(const GroupType & _groupType);
-
-        /// @brief Returns the content of the group.
-        std::unique_ptr<NameGenerator> emit();
+    /// The nodes, each one after its children.
+    std::vector<Node> nodes;
+    /// The children of the sequences and of the random choices.
+    std::vector<unsigned int> children;
+    /// The text of all the literals.
+    std::string literals;
+    /// The number of combinations.
+    size_t total;
+    /// The maximum length of a name.
+    size_t longest;
 
-        /// @brief Split the group.
-        void split();
+    /// @brief Adds a literal node.
+    unsigned int addLiteral(const std::string & value);
 
-        /// @brief Wrap the group with the given manipulator.
-        void wrap(const Manipulator & manipulator);
+    /// @brief Adds a sequence or a random choice between the given nodes.
+    unsigned int addList(Operation operation,
+                         const std::vector<unsigned int> & list);
 
-        /// @brief Add a generator to the internal set.
-        void add(std::unique_ptr<NameGenerator> && g);
+    /// @brief Adds a manipulator of the given node.
+    unsigned int addManipulator(Operation operation, unsigned int child);
 
-        /// @brief Creates a new generator with a single Literal in it (i.e. c).
-        virtual void add(char c);
+    /// @brief Evaluates the number of combinations and the maximum length
+    ///         of the name emitted by the node.
+    void measure(unsigned int node, size_t & combinations,
+                 size_t & length) const;
 
-    private:
-        /// @brief List of manipulators which need to be applied.
-        std::stack<Manipulator> manipulators;
-        /// @brief A vectors of generators.
-        std::vector<std::unique_ptr<NameGenerator>> set;
-    };
+    /// @brief Appends the output of the node to the buffer.
+    void emit(unsigned int node, std::string & buffer) const;
 
-    /// @brief A group of symbols.
-    class GroupSymbol :
-        public Group
-    {
-    public:
-        /// @brief Constructor.
-        GroupSymbol();
-
-        /// @brief Retrieves the set of strings associated with the given
-        /// symbol and add all of them as Literals to the list of generators.
-        void add(char c);
-    };
-
-    /// @brief A group of literals.
-    class GroupLiteral :
-        public Group
-    {
-    public:
-        /// @brief Constructor.
-        GroupLiteral();
-    };
-};
-
-/// @brief Used to pick a generator randomly from the internal list of
-/// generator.
-class Random :
-    public NameGenerator
-{
-public:
-    /// @brief Constructor.
-    Random();
-
-    /// @brief Constructor which takes a list of generators.
-    Random(std::vector<std::unique_ptr<NameGenerator>> && generators_);
-
-    size_t combinations() override;
-
-    size_t min() override;
-
-    size_t max() override;
-
-    std::string toString() override;
-};
-
-/// @brief Class used to store a sequence of generators.
-class Sequence :
-    public NameGenerator
-{
-public:
-    /// @brief Constructor.
-    Sequence();
-
-    /// @brief Constructor which takes a list of generators.
-    Sequence(std::vector<std::unique_ptr<NameGenerator>> && generators_);
-};
-
-/// @brief Class used to store a literal.
-class Literal :
-    public NameGenerator
-{
-    /// The string containing the single literal.
-    std::string value;
-
-public:
-    /// @brief Constructor which takes the string containing the literal.
-    Literal(const std::string & value_);
-
-    size_t combinations() override;
-
-    size_t min() override;
-
-    size_t max() override;
-
-    std::string toString() override;
-};
-
-/// @brief Class used to reverse a string.
-class Reverser :
-    public NameGenerator
-{
-public:
-    /// @brief Constructor which takes a generator.
-    Reverser(std::unique_ptr<NameGenerator> && g);
-
-    std::string toString() override;
-};
-
-/// @brief Class used to capitalize a string.
-class Capitalizer :
-    public NameGenerator
-{
-public:
-    /// @brief Constructor which takes a generator.
-    Capitalizer(std::unique_ptr<NameGenerator> && g);
-
-    std::string toString() override;
-};
-
-/// @brief Class used to collapse a string.
-class Collapser :
-    public NameGenerator
-{
-public:
-    /// @brief Constructor which takes a generator.
-    Collapser(std::unique_ptr<NameGenerator> && g);
+    /// The type of the map of symbols.
+    using SymbolMap = std::unordered_map<std::string,
+                                         const std::vector<std::string>>;
 
-    std::string toString() override;
+    /// @brief Returns the symbol map.
+    static const SymbolMap & getSymbolMap();
 };
 
 }
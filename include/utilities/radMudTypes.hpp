@@ -21,4 +21,10 @@
 
 #pragma once
 
-using VnumType = unsigned int;
\ No newline at end of file
+#include <memory>
+#include <string>
+
+using VnumType = unsigned int;
+
+/// An immutable message, formatted once and shared among its recipients.
+using SharedMessage = std::shared_ptr<const std::string>;
@@ -0,0 +1,167 @@
+/// @file   random.hpp
+/// @brief  Define the random number generators of the mud.
+/// @author Enrico Fraccaroli
+/// @date   Oct 19 2026
+/// @copyright
+/// Copyright (c) 2016 Enrico Fraccaroli <enrico.fraccaroli@gmail.com>
+/// Permission to use, copy, modify, and distribute this software for any
+/// purpose with or without fee is hereby granted, provided that the above
+/// copyright notice and this permission notice appear in all copies.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+/// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+/// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+/// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+/// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+/// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+/// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#pragma once
+
+#include <cstdint>
+#include <ctime>
+#include <deque>
+#include <limits>
+#include <string>
+
+/// @brief The xoshiro256** generator, which satisfies the requirements of
+///         UniformRandomBitGenerator and can be used with the distributions
+///         of the standard library.
+class Xoshiro256
+{
+private:
+    /// The state of the generator.
+    uint64_t state[4];
+
+public:
+    /// The type of the generated values.
+    using result_type = uint64_t;
+
+    /// @brief Constructor.
+    /// @param seed The initial seed.
+    explicit Xoshiro256(const uint64_t & seed = 0);
+
+    /// @brief Resets the state of the generator from the given seed.
+    void seed(uint64_t seed);
+
+    /// @brief Provides the smallest generated value.
+    static constexpr result_type min()
+    {
+        return 0;
+    }
+
+    /// @brief Provides the biggest generated value.
+    static constexpr result_type max()
+    {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    /// @brief Generates the next value.
+    inline result_type operator()()
+    {
+        auto result = rotate(state[1] * 5, 7) * 9;
+        auto t = state[1] << 17;
+        state[2] ^= state[0];
+        state[3] ^= state[1];
+        state[1] ^= state[2];
+        state[0] ^= state[3];
+        state[2] ^= t;
+        state[3] = rotate(state[3], 45);
+        return result;
+    }
+
+private:
+    /// @brief Rotates the bits of the value to the left.
+    static inline uint64_t rotate(const uint64_t & value, const int & bits)
+    {
+        return (value << bits) | (value >> (64 - bits));
+    }
+};
+
+/// @brief A seed used by a section of code which draws random values.
+struct RandomRecord
+{
+    /// The label of the section (e.g. "combat Goblin").
+    std::string label;
+    /// The seed used by the section.
+    uint64_t seed;
+    /// When the seed has been used.
+    time_t time;
+};
+
+/// @brief The service which provides a fast generator to each thread.
+/// @details
+/// The generator of each thread is derived from the master seed and the
+///  order in which the threads have drawn their first value. The sections
+///  which must be reproducible open a RandomScope, which records the seed
+///  they used and can be forced to use a given seed to replay them.
+class Random
+{
+public:
+    /// @brief Provides the generator of the calling thread.
+    static Xoshiro256 & generator();
+
+    /// @brief Sets the master seed and reseeds the calling thread.
+    static void seed(const uint64_t & seed);
+
+    /// @brief Provides the master seed.
+    static uint64_t getSeed();
+
+    /// @brief Draws a new seed for the section with the given label, or
+    ///         provides the seed set to replay it.
+    static uint64_t drawSeed(const std::string & label);
+
+    /// @brief Forces the next section with the given label to use the given
+    ///         seed.
+    static void setReplay(const std::string & label, const uint64_t & seed);
+
+    /// @brief Records the seed used by a section.
+    static void record(const std::string & label, const uint64_t & seed);
+
+    /// @brief Provides the most recent records, from the oldest.
+    static std::deque<RandomRecord> getRecords();
+};
+
+/// @brief Reseeds the generator of the calling thread for the lifetime of the
+///         object, and restores it afterwards.
+class RandomScope
+{
+private:
+    /// The state of the generator before the scope.
+    Xoshiro256 saved;
+    /// The seed used inside the scope.
+    uint64_t seed;
+    /// The generator used inside the scope, if it is not seeded by it.
+    Xoshiro256 * source;
+
+public:
+    /// @brief Constructor, draws and records a new seed.
+    /// @param label The label of the section.
+    explicit RandomScope(const std::string & label);
+
+    /// @brief Constructor, uses and records the given seed.
+    /// @param label The label of the section.
+    /// @param _seed The seed.
+    RandomScope(const std::string & label, const uint64_t & _seed);
+
+    /// @brief Constructor, continues the sequence of the given generator,
+    ///         whose seed has been recorded when it has been seeded.
+    /// @param _source The generator, which is advanced by the scope.
+    explicit RandomScope(Xoshiro256 & _source);
+
+    /// @brief Destructor.
+    ~RandomScope();
+
+    /// @brief Disable Copy Construct.
+    RandomScope(RandomScope const &) = delete;
+
+    /// @brief Disable Copy assign.
+    RandomScope & operator=(RandomScope const &) = delete;
+
+    /// @brief Provides the seed used inside the scope, zero if the scope
+    ///         continues the sequence of another generator.
+    inline uint64_t getSeed() const
+    {
+        return seed;
+    }
+};
@@ -0,0 +1,120 @@
+/// @file   slabPool.hpp
+/// @brief  Define the pools used to allocate the items, rooms and mobiles.
+/// @author Enrico Fraccaroli
+/// @date   Oct 19 2026
+/// @copyright
+/// Copyright (c) 2016 Enrico Fraccaroli <enrico.fraccaroli@gmail.com>
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///     The above copyright notice and this permission notice shall be included
+///     in all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/// @brief The state of a pool.
+struct SlabPoolStatistics
+{
+    /// The family of objects allocated by the pool.
+    std::string family;
+    /// The size of the allocated objects.
+    size_t objectSize;
+    /// The size of each slot.
+    size_t slotSize;
+    /// The slots currently in use.
+    size_t live;
+    /// The slots ready to be reused.
+    size_t free;
+    /// The number of allocated slabs.
+    size_t slabs;
+};
+
+/// @brief Pool of slots of the same size, allocated in slabs.
+/// @details
+/// The slabs are never released, so that the slots keep a stable address
+///  and the freed ones are reused by the next objects of the same size,
+///  instead of fragmenting the heap.
+class SlabPool
+{
+private:
+    /// The family of objects allocated by the pool.
+    std::string family;
+    /// The size of the allocated objects.
+    size_t objectSize;
+    /// The size of each slot.
+    size_t slotSize;
+    /// The allocated slabs.
+    std::vector<std::unique_ptr<char[]>> slabs;
+    /// The list of free slots, linked through their first bytes.
+    void * freeList;
+    /// The slots currently in use.
+    size_t live;
+    /// Mutex used to protect the pool.
+    mutable std::mutex poolMutex;
+
+public:
+    /// The number of slots inside each slab.
+    static const size_t SlotsPerSlab = 64;
+
+    /// @brief Constructor.
+    /// @param _family     The family of objects allocated by the pool.
+    /// @param _objectSize The size of the objects.
+    SlabPool(std::string _family, size_t _objectSize);
+
+    /// @brief Provides a free slot, allocating a new slab if needed.
+    void * allocate();
+
+    /// @brief Gives the slot back to the pool.
+    void deallocate(void * slot);
+
+    /// @brief Provides the state of the pool.
+    SlabPoolStatistics getStatistics() const;
+
+private:
+    /// @brief Allocates a new slab and adds its slots to the free ones.
+    void addSlab();
+};
+
+/// @brief Dispatches the allocations of a family of objects to the pool
+///         handling their size.
+/// @details
+/// A family (e.g. the items) is made of classes sharing the same operator
+///  new, so each of its subclasses ends up inside the pool of its own size.
+class SlabAllocator
+{
+public:
+    /// @brief Allocates an object of the given family.
+    /// @param family The family of the object, it must be a string literal.
+    /// @param size   The size of the object.
+    static void * allocate(const char * family, size_t size);
+
+    /// @brief Deallocates an object of the given family.
+    /// @param family  The family of the object, it must be a string literal.
+    /// @param pointer The object.
+    /// @param size    The size of the object.
+    static void deallocate(const char * family, void * pointer, size_t size);
+
+    /// @brief Provides the state of all the pools.
+    static std::vector<SlabPoolStatistics> getStatistics();
+
+private:
+    /// @brief Provides the pool of the given family and size.
+    static SlabPool & getPool(const char * family, size_t size);
+};
@@ -22,9 +22,19 @@
 #pragma once
 
 #include <type_traits>
-#include <sstream>
+#include <string_view>
+#include <charconv>
+#include <cstdio>
+#include <string>
 
 /// @brief Allows to build a string from a series of arguments.
+/// @details
+/// The format string is scanned only once, and every occurrence of the
+///  pattern '%s' is replaced by the next argument, which is written directly
+///  inside the output. The arguments can be strings or arithmetic values,
+///  any other type is rejected at compile time. The patterns which are left
+///  without an argument are kept as they are, while the arguments which are
+///  left without a pattern are ignored.
 class StringBuilder
 {
 private:
@@ -34,7 +44,127 @@ private:
         // Nothing to do.
     }
 
+    /// @brief Appends a string argument.
+    static inline void appendValue(std::string & output,
+                                   std::string_view value)
+    {
+        output.append(value.data(), value.size());
+    }
+
+    /// @brief Appends a string literal argument.
+    static inline void appendValue(std::string & output, const char * value)
+    {
+        output.append(value);
+    }
+
+    /// @brief Appends a boolean argument, as it would be streamed.
+    static inline void appendValue(std::string & output, bool value)
+    {
+        output.push_back(value ? '1' : '0');
+    }
+
+    /// @brief Appends a character argument, as it would be streamed.
+    static inline void appendValue(std::string & output, char value)
+    {
+        output.push_back(value);
+    }
+
+    /// @brief Appends a character argument, as it would be streamed.
+    static inline void appendValue(std::string & output, signed char value)
+    {
+        output.push_back(static_cast<char>(value));
+    }
+
+    /// @brief Appends a character argument, as it would be streamed.
+    static inline void appendValue(std::string & output, unsigned char value)
+    {
+        output.push_back(static_cast<char>(value));
+    }
+
+    /// @brief Appends an integer argument, without intermediate strings.
+    template<
+        typename T,
+        typename = typename std::enable_if<std::is_integral<T>::value>::type>
+    static inline void appendValue(std::string & output, const T & value)
+    {
+        // Large enough for any 64-bit value and its sign.
+        char buffer[24];
+        auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+        output.append(buffer, result.ptr);
+    }
+
+    /// @brief Appends a floating point argument, with the same precision
+    ///         used by the streams.
+    static inline void appendValue(std::string & output, double value)
+    {
+        char buffer[32];
+        auto length = std::snprintf(buffer, sizeof(buffer), "%g", value);
+        if (length > 0)
+        {
+            output.append(buffer, static_cast<size_t>(length));
+        }
+    }
+
+    /// @brief Cover the other floating point types.
+    static inline void appendValue(std::string & output, float value)
+    {
+        appendValue(output, static_cast<double>(value));
+    }
+
+    /// @brief Cover the other floating point types.
+    static inline void appendValue(std::string & output, long double value)
+    {
+        appendValue(output, static_cast<double>(value));
+    }
+
+    /// @brief Appends the text up to the next pattern, followed by the
+    ///         given argument.
+    /// @param output   Where the string is built.
+    /// @param str      The format string.
+    /// @param position The position inside the format string, it is set to
+    ///                  npos once the format string has been exhausted.
+    /// @param value    The argument.
+    template<typename T>
+    static inline void appendNext(std::string & output,
+                                  const std::string & str,
+                                  std::string::size_type & position,
+                                  const T & value)
+    {
+        if (position == std::string::npos)
+        {
+            return;
+        }
+        auto found = str.find("%s", position);
+        if (found == std::string::npos)
+        {
+            output.append(str, position, std::string::npos);
+            position = std::string::npos;
+            return;
+        }
+        output.append(str, position, found - position);
+        appendValue(output, value);
+        position = found + 2;
+    }
+
 public:
+    /// @brief Replaces all the occurrences of the pattern '%s' with
+    ///         the arguments, appending the result to the output.
+    /// @param output Where the string is built.
+    /// @param str    The string that has to be built.
+    /// @param args   Packed arguments.
+    template<typename ... Args>
+    static void append(std::string & output,
+                       const std::string & str,
+                       const Args & ... args)
+    {
+        std::string::size_type position = 0;
+        (appendNext(output, str, position, args), ...);
+        if (position != std::string::npos)
+        {
+            output.append(str, position, std::string::npos);
+        }
+    }
+
     /// @brief Replaces all the occurrences of the pattern '%s' with
     ///         the arguments.
     /// @param str The string that has to be built.
@@ -50,36 +180,14 @@ public:
     /// @param first The first unpacked argument.
     /// @param args  Packed arguments.
     /// @return The customized string.
-    template<typename ... Args>
+    template<typename First, typename ... Args>
     static std::string build(const std::string & str,
-                             const std::string & first,
+                             const First & first,
                              const Args & ... args)
     {
-        std::string::size_type pos = str.find("%s");
-        if (pos == std::string::npos)
-        {
-            return str;
-        }
-        else
-        {
-            std::string working = str;
-            working.replace(pos, 2, first);
-            return build(working, args ...);
-        }
+        std::string output;
+        output.reserve(str.size() + 16 * (1 + sizeof...(Args)));
+        append(output, str, first, args ...);
+        return output;
     }
-
-    /// @brief Cover the case in which the first argument is a signed value.
-    template<
-        typename T,
-        typename ... Args,
-        typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
-    static std::string build(const std::string & str,
-                             const T & first,
-                             const Args & ... args)
-    {
-        std::stringstream ss;
-        ss << first;
-        return build(str, ss.str(), args ...);
-    }
-
-};
\ No newline at end of file
+};
@@ -53,7 +53,7 @@ public:
 
     /// @brief Provide access to the title of the column.
     /// @return The title of the column
-    inline std::string getTitle() const
+    inline const std::string & getTitle() const
     {
         return title;
     }
@@ -67,7 +67,7 @@ public:
 
     /// @brief Provides access to the allignment of the column.
     /// @return The allignment of the column.
-    inline align::align_t getAlignment()
+    inline align::align_t getAlignment() const
     {
         return alignment;
     }
@@ -81,6 +81,9 @@ public:
 };
 
 /// @brief A simple formatted table.
+/// @details
+/// The table can be limited to a page of rows, so that the listings of the
+///  whole world only build and render the rows which are actually shown.
 class Table
 {
 private:
@@ -90,17 +93,35 @@ private:
     std::vector<TableColumn> columns;
     /// List of rows of the table.
     std::vector<TableRow> rows;
+    /// The number of rows which precede the page.
+    size_t firstRow;
+    /// The maximum number of rows of the page.
+    size_t maxRows;
+    /// The number of rows added so far, including the skipped ones.
+    size_t totalRows;
 
 public:
     /// @brief Constructor.
-    Table() = default;
+    Table() :
+        title(),
+        columns(),
+        rows(),
+        firstRow(),
+        maxRows(std::string::npos),
+        totalRows()
+    {
+        // Nothing to do.
+    }
 
     /// @brief Constructor.
     /// @param _title The title of the table.
     explicit Table(std::string _title) :
         title(std::move(_title)),
         columns(),
-        rows()
+        rows(),
+        firstRow(),
+        maxRows(std::string::npos),
+        totalRows()
     {
         // Nothing to do.
     }
@@ -117,18 +138,39 @@ public:
     }
 
     /// @brief Allows to add a row of values.
+    /// @details If the table is limited to a page, the rows outside of it
+    ///           are only counted.
     /// @param row The vector which containts the row values.
     inline void addRow(TableRow row)
     {
         if (row.size() == columns.size())
         {
+            if ((totalRows++ < firstRow) || (rows.size() >= maxRows))
+            {
+                return;
+            }
             for (size_t i = 0; i < columns.size(); ++i)
             {
                 columns[i].setWidth(row[i].size());
             }
-            rows.push_back(row);
+            rows.emplace_back(std::move(row));
         }
     }
+
+    /// @brief Counts the next row without adding it, if it falls outside
+    ///         of the page, so that it does not even need to be built.
+    /// @return <b>True</b> if the row has been skipped,<br>
+    ///         <b>False</b> if it has to be added.
+    inline bool skipRow()
+    {
+        if ((totalRows < firstRow) || (rows.size() >= maxRows))
+        {
+            ++totalRows;
+            return true;
+        }
+        return false;
+    }
+
     /// @brief Provides the number of rows inside the table.
     /// @return The number of rows.
     inline size_t getNumRows() const
@@ -136,6 +178,23 @@ public:
         return rows.size();
     }
 
+    /// @brief Provides the number of rows added to the table, including
+    ///         the ones outside of the page.
+    /// @return The total number of rows.
+    inline size_t getTotalRows() const
+    {
+        return totalRows;
+    }
+
+    /// @brief Limits the table to the given page.
+    /// @param page        The page, starting from 1.
+    /// @param rowsPerPage The number of rows of each page.
+    inline void setPage(size_t page, size_t rowsPerPage)
+    {
+        firstRow = (page > 0) ? (page - 1) * rowsPerPage : 0;
+        maxRows = rowsPerPage;
+    }
+
     /// @brief Adds an empty row as divider.
     inline void addDivider()
     {
@@ -149,48 +208,22 @@ public:
     }
 
     /// @brief Provides the table.
-    /// @param withoutHeaders Allows to hide the header of the columns.
+    /// @param withoutHeaders  Allows to hide the header of the columns.
+    /// @param withoutDividers Allows to hide the dividers.
     /// @return The table.
     std::string getTable(bool withoutHeaders = false,
-                         bool withoutDividers = false);
+                         bool withoutDividers = false) const;
 
-private:
-    /// @brief Provides a divided of the same width of the table.
-    /// @return The divider.
-    inline std::string getDivider() const
-    {
-        std::string output;
-        for (const auto & column : columns)
-        {
-            output += "#" + std::string(column.getWidth(), '#');
-        }
-        return output += "#\n";
-    }
-
-    /// @brief Provides the table title.
-    /// @return The table title.
-    inline std::string getTitle() const
-    {
-        return "#" +
-               Align(title, align::center,
-                     getTotalWidth() + (columns.size() - 1)) + "#\n";
-    }
-
-    /// @brief Provides the columns headers.
-    /// @return The headers.
-    inline std::string getHeaders() const
-    {
-        std::string output;
-        for (const auto & it : columns)
-        {
-            output += "|" +
-                      Align(it.getTitle(),
-                            align::center,
-                            it.getWidth());
-        }
-        return output + "|\n";
-    }
+    /// @brief Renders the table at the end of the given output, which is
+    ///         enlarged only once to the final size.
+    /// @param output          Where the table is rendered.
+    /// @param withoutHeaders  Allows to hide the header of the columns.
+    /// @param withoutDividers Allows to hide the dividers.
+    void renderTable(std::string & output,
+                     bool withoutHeaders = false,
+                     bool withoutDividers = false) const;
 
+private:
     /// @brief Provides the total width of th table.
     /// @return The total width.
     inline size_t getTotalWidth() const
@@ -202,4 +235,10 @@ private:
         }
         return totalWidth;
     }
+
+    /// @brief Appends a divider of the same width of the table.
+    void renderDivider(std::string & output) const;
+
+    /// @brief Appends a line made of the given cells.
+    void renderLine(std::string & output, const TableRow & row) const;
 };
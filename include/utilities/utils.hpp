@@ -27,10 +27,13 @@
 #include <set>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <vector>
 #include <iostream>
 
+#include "utilities/random.hpp"
+
 /// Allows to define a non-aborting assertion for correct guards.
 #define CorrectAssert(e) ( (e) ? true : (\
     std::cerr << "Assertion :"#e<<"\n",\
@@ -112,47 +115,68 @@ void ClearFlag(unsigned int & flags, Enum flag)
 /// @param prefix Prefix string.
 /// @return <b>True</b> if the source begin with the given prefix,<br>
 ///         <b>False</b> otherwise.
-bool BeginWith(const std::string & source, const std::string & prefix);
+bool BeginWith(std::string_view source, std::string_view prefix);
+
+/// @brief Check if the source string begin with a given prefix, ignoring
+///         the case of the letters.
+/// @param source Source string.
+/// @param prefix Prefix string.
+/// @return <b>True</b> if the source begin with the given prefix,<br>
+///         <b>False</b> otherwise.
+bool BeginWithNoCase(std::string_view source, std::string_view prefix);
+
+/// @brief Check if the two strings are the same, ignoring the case of
+///         the letters.
+/// @param first  The first string.
+/// @param second The second string.
+/// @return <b>True</b> if they are the same string,<br>
+///         <b>False</b> otherwise.
+bool EqualNoCase(std::string_view first, std::string_view second);
 
 /// @brief Check if the source string end with a given string.
 /// @param source Source string.
 /// @param suffix Final string.
 /// @return <b>True</b> if the source end with the given postfix,<br>
 ///         <b>False</b> otherwise.
-bool EndWith(const std::string & source, const std::string & suffix);
+bool EndWith(std::string_view source, std::string_view suffix);
 
 /// @brief Find and replace in a string.
 /// @param source      Source string.
 /// @param target      Target sub-string.
 /// @param replacement Replacement for the sub-string.
 void FindAndReplace(std::string * source,
-                    const std::string & target,
-                    const std::string & replacement);
+                    std::string_view target,
+                    std::string_view replacement);
 
 /// @brief Get rid of leading and trailing spaces from a string
 /// @param source Source string.
 /// @param trim   Trim condition.
 /// @return String modified.
-std::string Trim(const std::string & source,
-                 const std::string & trim = std::string(" \t\r\n"));
+std::string Trim(std::string_view source,
+                 std::string_view trim = " \t\r\n");
 
 /// @brief Convert all the stirng to lowercase.
 /// @param source Source string.
 /// @return String modified.
-std::string ToLower(const std::string & source);
+std::string ToLower(std::string_view source);
+
+/// @brief Appends the string to the output, converted to lowercase.
+/// @param output Where the string is appended.
+/// @param source Source string.
+void AppendLower(std::string & output, std::string_view source);
 
 /// @brief Capitalise the first letters of all the words in the string.
 /// @param source Source string.
 /// @return String modified.
-std::string ToCapitals(const std::string & source);
+std::string ToCapitals(std::string_view source);
 
 /// @brief Given a string and a delimiter, the string is splitted
 ///         by using the delimiter.
 /// @param source    The source string.
 /// @param delimiter The delimiter which has to be used.
 /// @return The splitted string.
-std::vector<std::string> SplitString(const std::string & source,
-                                     const std::string & delimiter);
+std::vector<std::string> SplitString(std::string_view source,
+                                     std::string_view delimiter);
 
 /// @brief Get all the words in the source string.
 /// @param source The source string.
@@ -199,6 +223,7 @@ std::string ToString(const T & value)
 }
 
 /// @brief Generate a random integral value between the defined range.
+/// @details The value is drawn from the generator of the calling thread.
 /// @param lowerBound The lower bound for the random value.
 /// @param upperBound The upper bound for the random value.
 /// @return The generated random value.
@@ -207,9 +232,7 @@ template<typename T,
 T TRand(const T & lowerBound, const T & upperBound)
 {
     std::uniform_int_distribution<T> distribution(lowerBound, upperBound);
-    std::random_device randomDevice;
-    std::default_random_engine generator(randomDevice());
-    return distribution(generator);
+    return distribution(Random::generator());
 }
 
 /// @brief Generate a random integral value between the defined range.
@@ -221,9 +244,7 @@ template<typename T,
 T TRandReal(const T & lowerBound, const T & upperBound)
 {
     std::uniform_real_distribution<T> distribution(lowerBound, upperBound);
-    std::random_device randomDevice;
-    std::default_random_engine generator(randomDevice());
-    return distribution(generator);
+    return distribution(Random::generator());
 }
 
 /// @brief Normalizes the value from a range to another.
@@ -242,7 +263,7 @@ T Normalize(T v, T from_lb, T from_ub, T to_lb, T to_ub)
 /// @brief Check if the string is a number.
 /// @param source The string to check.
 /// @return <b>True</b> if the string it's a number, <b>False</b> otherwise.
-bool IsNumber(const std::string & source);
+bool IsNumber(std::string_view source);
 
 /// @brief Retrieve the content of a file.
 /// @param filename The path and name of the file to read.
@@ -0,0 +1,90 @@
+/// @file   workerPool.hpp
+/// @brief  Define the class WorkerPool.
+/// @author Enrico Fraccaroli
+/// @date   Oct 19 2026
+/// @copyright
+/// Copyright (c) 2016 Enrico Fraccaroli <enrico.fraccaroli@gmail.com>
+/// Permission to use, copy, modify, and distribute this software for any
+/// purpose with or without fee is hereby granted, provided that the above
+/// copyright notice and this permission notice appear in all copies.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+/// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+/// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+/// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+/// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+/// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+/// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/// @brief A fixed set of threads which split among them the iterations of
+///         a loop.
+class WorkerPool
+{
+public:
+    /// The body of a parallel loop, which receives the range of iterations
+    /// [begin, end) and the index of the band executing it.
+    using Body = std::function<void(size_t begin, size_t end, size_t band)>;
+
+private:
+    /// The threads of the pool.
+    std::vector<std::thread> workers;
+    /// Protects the state shared with the workers.
+    std::mutex mutex;
+    /// Used to wake up the workers when there is a new loop.
+    std::condition_variable wakeUp;
+    /// Used to notify that all the workers have finished their band.
+    std::condition_variable finished;
+    /// The body of the current loop.
+    const Body * body;
+    /// The number of iterations of the current loop.
+    size_t count;
+    /// Incremented for every new loop.
+    unsigned long generation;
+    /// The number of workers which are still executing their band.
+    size_t pending;
+    /// Tells the workers to terminate.
+    bool stopping;
+
+public:
+    /// @brief Constructor.
+    /// @param numBands The number of bands in which the loops are split,
+    ///                  the calling thread executes one of them. If zero,
+    ///                  the number of hardware threads is used.
+    explicit WorkerPool(unsigned int numBands = 0);
+
+    /// @brief Destructor.
+    ~WorkerPool();
+
+    /// @brief Disable copy constructor.
+    WorkerPool(const WorkerPool & source) = delete;
+
+    /// @brief Disable assign operator.
+    WorkerPool & operator=(const WorkerPool &) = delete;
+
+    /// @brief Provides the number of bands in which the loops are split.
+    inline size_t size() const
+    {
+        return workers.size() + 1;
+    }
+
+    /// @brief Splits the iterations [0, count) in contiguous bands and
+    ///         executes them in parallel, returning when all are done.
+    /// @param count The number of iterations.
+    /// @param body  The body of the loop.
+    void parallelFor(const size_t & count, const Body & body);
+
+private:
+    /// @brief Provides the range of iterations of the given band.
+    void getBand(const size_t & band, size_t & begin, size_t & end) const;
+
+    /// @brief The loop executed by each worker.
+    void workerLoop(const size_t & band);
+};
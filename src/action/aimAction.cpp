@@ -94,7 +94,7 @@ ActionStatus AimAction::perform()
         actor->sendMsg(error + "\n\n");
         return ActionStatus::Error;
     }
-    if (GetActiveWeapons<RangedWeaponItem>(actor).empty())
+    if (actor->combatProfile.getRangedWeapons().empty())
     {
         actor->sendMsg("You don't have a ranged weapon equipped.\n\n");
         return ActionStatus::Error;
@@ -22,6 +22,7 @@
 
 #include "action/buildAction.hpp"
 
+#include "character/characterUtilities.hpp"
 #include "model/submodel/resourceModel.hpp"
 #include "utilities/formatter.hpp"
 #include "updater/updater.hpp"
@@ -103,31 +104,11 @@ bool BuildAction::check(std::string & error) const
         error = "You are too tired right now.";
         return false;
     }
-    // Check if the actor has enough ingredients.
-    for (auto it : schematics->ingredients)
+    // Check if the reserved ingredients are still available.
+    if (!HasReservedResources(schematics->ingredients, ingredients))
     {
-        auto required = it.second;
-        for (auto it2 : ingredients)
-        {
-            auto item = it2.first;
-            if (item->getType() == ModelType::Resource)
-            {
-                auto resourceModel = item->model->toResource();
-                if (resourceModel->resourceType == it.first)
-                {
-                    required -= item->quantity;
-                    if (required <= 0)
-                    {
-                        break;
-                    }
-                }
-            }
-        }
-        if (required > 0)
-        {
-            error = "You don't have enough materials.";
-            return false;
-        }
+        error = "You don't have enough materials.";
+        return false;
     }
     return true;
 }
@@ -173,6 +154,7 @@ ActionStatus BuildAction::perform()
         else
         {
             ingredient->quantity -= it.second;
+            ingredient->invalidateWeight();
         }
     }
     for (auto iterator : tools)
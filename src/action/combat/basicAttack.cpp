@@ -28,6 +28,7 @@
 #include "utilities/formatter.hpp"
 #include "updater/updater.hpp"
 #include "utilities/logger.hpp"
+#include "action/combat/combatArena.hpp"
 #include "action/combat/chase.hpp"
 #include "structure/room.hpp"
 #include "structure/area.hpp"
@@ -68,6 +69,7 @@ std::string BasicAttack::stop()
 
 ActionStatus BasicAttack::perform()
 {
+    ArenaProbe probe("BasicAttack::perform");
     std::string error;
     if (!this->check(error))
     {
@@ -82,6 +84,9 @@ ActionStatus BasicAttack::perform()
         // Return that the action is finished.
         return ActionStatus::Finished;
     }
+    // Draw the rolls from the generator of the combat, whose seed has been
+    // recorded when the combat started, so that it can be replayed.
+    RandomScope randomScope(actor->combatHandler.getGenerator());
     // Flag used to determine if the actor WAS able to attack the target.
     bool hasAttackedTheTarget = false;
     // Find a valid predefined target.
@@ -91,12 +96,28 @@ ActionStatus BasicAttack::perform()
         unsigned int attackNumber = 0;
         // Get the predefined target.
         Character * predefined = actor->combatHandler.getPredefinedTarget();
+        // The line of sight towards the target depends only on the range,
+        // evaluate it once for each distinct range.
+        std::vector<std::pair<int, bool>> reachable;
+        auto IsAtRange = [&](const int & range)
+        {
+            for (auto const & it : reachable)
+            {
+                if (it.first == range)
+                {
+                    return it.second;
+                }
+            }
+            auto result = actor->isAtRange(predefined, range);
+            reachable.emplace_back(range, result);
+            return result;
+        };
         // If the actor and the pred-target are in the same room,
         //  first use the melee weapons.
         if (actor->room->coord == predefined->room->coord)
         {
             // Retrieve all the melee weapons.
-            auto meleeWeapons = GetActiveWeapons<MeleeWeaponItem>(actor);
+            auto const & meleeWeapons = actor->combatProfile.getMeleeWeapons();
             // Perform the attack for each melee weapon.
             for (auto weapon : meleeWeapons)
             {
@@ -108,12 +129,12 @@ ActionStatus BasicAttack::perform()
             }
         }
         // Retrieve all the ranged weapons.
-        auto rangedWeapons = GetActiveWeapons<RangedWeaponItem>(actor);
+        auto const & rangedWeapons = actor->combatProfile.getRangedWeapons();
         // Perform the attack for each weapon.
         for (auto weapon : rangedWeapons)
         {
             // Check if the target is at range of the weapon.
-            if (actor->isAtRange(predefined, weapon->getRange()))
+            if (IsAtRange(weapon->getRange()))
             {
                 // Set that the actor has actually attacked the target.
                 // Perform the attack passing the ranged weapon.
@@ -124,12 +145,12 @@ ActionStatus BasicAttack::perform()
             }
         }
         // Retrieve all the natural weapons.
-        auto naturalWeapon = GetActiveNaturalWeapons(actor);
+        auto const & naturalWeapon = actor->combatProfile.getNaturalWeapons();
         // Perform the attack for each natural weapon.
         for (auto const & weapon : naturalWeapon)
         {
             // Check if the target is at range of the weapon.
-            if (actor->isAtRange(predefined, weapon->range))
+            if (IsAtRange(weapon->range))
             {
                 // Set that the actor has actually attacked the target.
                 // Perform the attack passing the melee weapon.
@@ -141,6 +162,8 @@ ActionStatus BasicAttack::perform()
                 ++attackNumber;
             }
         }
+        // Account the executed attacks to the arena, if one is running.
+        CombatArena::addAttacks(attackNumber);
     }
     // Check if the actor has not attacked anyone.
     if (!hasAttackedTheTarget)
@@ -191,13 +214,9 @@ CombatActionType BasicAttack::getCombatActionType() const
 unsigned int BasicAttack::getConsumedStamina(Character * character,
                                              Item * weapon)
 {
-    // BASE     [+1.0]
-    // STRENGTH [-0.0 to -1.40]
-    // WEIGHT   [+1.6 to +2.51]
+    // BASE + STRENGTH + WEIGHT [see CombatProfile]
     // CARRIED  [+0.0 to +2.48]
-    unsigned int consumedStamina = 1;
-    consumedStamina -= character->getAbilityLog(Ability::Strength);
-    consumedStamina = SafeSum(consumedStamina, SafeLog10(character->weight));
+    auto consumedStamina = character->combatProfile.getBaseStamina();
     consumedStamina = SafeSum(consumedStamina,
                               SafeLog10(character->getCarryingWeight()));
     if (weapon == nullptr)
@@ -226,19 +245,16 @@ unsigned int BasicAttack::getConsumedStamina(
     Character * character,
     const std::shared_ptr<BodyPart::BodyWeapon> &)
 {
-    // BASE     [+1.0]
-    // STRENGTH [-0.0 to -1.40]
-    // WEIGHT   [+1.6 to +2.51]
+    // BASE + STRENGTH + WEIGHT [see CombatProfile]
     // CARRIED  [+0.0 to +2.48]
-    unsigned int result = 1;
-    result -= character->getAbilityLog(Ability::Strength);
-    result = SafeSum(result, SafeLog10(character->weight));
+    auto result = character->combatProfile.getBaseStamina();
     result = SafeSum(result, SafeLog10(character->getCarryingWeight()));
     return result;
 }
 
 bool BasicAttack::setPredefinedTarget()
 {
+    ArenaProbe probe("BasicAttack::setPredefinedTarget");
     // If there is a predefined target, check if it is a valid target.
     if (actor->combatHandler.getPredefinedTarget() != nullptr)
     {
@@ -263,15 +279,15 @@ bool BasicAttack::setPredefinedTarget()
                     actor->getNameCapital());
     }
     // Take a valid target.
-    for (auto const & it : actor->combatHandler)
+    for (auto const & it : actor->combatHandler.getSortedOpponents())
     {
-        if (this->checkTarget(it->aggressor))
+        if (this->checkTarget(it.aggressor))
         {
             Logger::log(LogLevel::Debug,
                         "[%s] Has a new predefined target: %s",
                         actor->getNameCapital(),
-                        it->aggressor->getNameCapital());
-            actor->combatHandler.setPredefinedTarget(it->aggressor);
+                        it.aggressor->getNameCapital());
+            actor->combatHandler.setPredefinedTarget(it.aggressor);
             return true;
         }
     }
@@ -318,7 +334,7 @@ bool BasicAttack::checkTarget(Character * target)
                     "[%s] The aimed character and the target are the same character.",
                     actor->getNameCapital());
         // Retrieve all the ranged weapons.
-        auto rangedWeapons = GetActiveWeapons<RangedWeaponItem>(actor);
+        auto const & rangedWeapons = actor->combatProfile.getRangedWeapons();
         // Check if the actor has no ranged weapon equipped.
         if (rangedWeapons.empty())
         {
@@ -353,6 +369,7 @@ bool BasicAttack::performAttackNaturalWeapon(
     const std::shared_ptr<BodyPart::BodyWeapon> & weapon,
     unsigned int attackNumber)
 {
+    ArenaProbe probe("BasicAttack::performAttackNaturalWeapon");
     // -------------------------------------------------------------------------
     // Preamble: Evaluate all the values which are required by the function.
     // -------------------------------------------------------------------------
@@ -478,6 +495,7 @@ bool BasicAttack::performMeleeAttack(Character * target,
                                      MeleeWeaponItem * weapon,
                                      unsigned int attackNumber)
 {
+    ArenaProbe probe("BasicAttack::performMeleeAttack");
     // -------------------------------------------------------------------------
     // Preamble: Evaluate all the values which are required by the function.
     // -------------------------------------------------------------------------
@@ -599,6 +617,7 @@ bool BasicAttack::performRangedAttack(Character * target,
                                       RangedWeaponItem * weapon,
                                       unsigned int attackNumber)
 {
+    ArenaProbe probe("BasicAttack::performRangedAttack");
     // -------------------------------------------------------------------------
     // Preamble: Evaluate all the values which are required by the function.
     // -------------------------------------------------------------------------
@@ -657,6 +676,7 @@ bool BasicAttack::performRangedAttack(Character * target,
     else
     {
         projectile->quantity -= 1;
+        projectile->invalidateWeight();
     }
     // -------------------------------------------------------------------------
     // Phase 4: Check if the target is hit.
@@ -789,7 +809,7 @@ void BasicAttack::handleRangedHit(Character * target, RangedWeaponItem * weapon)
     {
         target->sendMsg("%s fires a projectile which hits you.\n\n",
                         actor->getNameCapital());
-        actor->room->funcSendToAll(
+        actor->room->funcSendToObservers(
             "%s fires and hits %s with %s.\n",
             [&](Character * character)
             {
@@ -810,48 +830,41 @@ void BasicAttack::handleRangedHit(Character * target, RangedWeaponItem * weapon)
     {
         target->sendMsg("Someone fires a projectile that hits you.\n\n");
     }
-    actor->room->funcSendToAll(
+    // The characters which can see the actor.
+    actor->room->funcSendToObservers(
         "%s fires and hits %s with %s.\n",
         [&](Character * character)
         {
             if ((character == actor) || (character == target)) return false;
-            if (character->combatHandler.charactersInSight.containsCharacter(
-                target))
-                return true;
+            if (character->areaOfInterest.canSee(target->room)) return true;
             return character->combatHandler.getAimedTarget() == target;
         }, actor->getNameCapital(), target->getName(),
         weapon->getName(true));
 
-    actor->room->funcSendToAll(
+    actor->room->funcSendToObservers(
         "%s fires at someone or something with %s.\n",
         [&](Character * character)
         {
             if ((character == actor) || (character == target)) return false;
-            if (character->combatHandler.charactersInSight.containsCharacter(
-                target))
-                return false;
+            if (character->areaOfInterest.canSee(target->room)) return false;
             return character->combatHandler.getAimedTarget() != target;
         }, actor->getNameCapital(), weapon->getName(true));
-
-    target->room->funcSendToAll(
+    // The characters which can see only the target.
+    target->room->funcSendToObservers(
         "%s fires a projectile which hits %s.\n",
         [&](Character * character)
         {
             if ((character == actor) || (character == target)) return false;
-            if (character->combatHandler.charactersInSight.containsCharacter(
-                actor))
-                return true;
+            if (character->areaOfInterest.canSee(actor->room)) return false;
             return character->combatHandler.getAimedTarget() == actor;
         }, actor->getNameCapital(), target->getName(), weapon->getName(true));
 
-    target->room->funcSendToAll(
+    target->room->funcSendToObservers(
         "Someone fires a projectile which hits %s.\n",
         [&](Character * character)
         {
             if ((character == actor) || (character == target)) return false;
-            if (character->combatHandler.charactersInSight.containsCharacter(
-                actor))
-                return false;
+            if (character->areaOfInterest.canSee(actor->room)) return false;
             return character->combatHandler.getAimedTarget() != actor;
         }, target->getName());
 }
@@ -902,7 +915,7 @@ BasicAttack::handleRangedMiss(Character * target, RangedWeaponItem * weapon)
     {
         target->sendMsg("%s fires an misses you.\n\n",
                         actor->getName());
-        actor->room->funcSendToAll(
+        actor->room->funcSendToObservers(
             "%s fires and misses %s with %s.\n",
             [&](Character * character)
             {
@@ -920,47 +933,40 @@ BasicAttack::handleRangedMiss(Character * target, RangedWeaponItem * weapon)
     {
         target->sendMsg("Someone fired at you, but missed.\n\n");
     }
-    actor->room->funcSendToAll(
+    // The characters which can see the actor.
+    actor->room->funcSendToObservers(
         "%s fires and misses %s with %s.\n",
         [&](Character * character)
         {
             if ((character == actor) || (character == target)) return false;
-            if (character->combatHandler.charactersInSight.containsCharacter(
-                target))
-                return true;
+            if (character->areaOfInterest.canSee(target->room)) return true;
             return character->combatHandler.getAimedTarget() == target;
         }, actor->getNameCapital(), target->getName(), weapon->getName(true));
 
-    actor->room->funcSendToAll(
+    actor->room->funcSendToObservers(
         "%s fires at someone or something with %s.\n",
         [&](Character * character)
         {
             if ((character == actor) || (character == target)) return false;
-            if (character->combatHandler.charactersInSight.containsCharacter(
-                target))
-                return false;
+            if (character->areaOfInterest.canSee(target->room)) return false;
             return character->combatHandler.getAimedTarget() != target;
         }, actor->getNameCapital(), weapon->getName(true));
-
-    target->room->funcSendToAll(
+    // The characters which can see only the target.
+    target->room->funcSendToObservers(
         "%s fires a projectile which whizzes nearby %s.\n",
         [&](Character * character)
         {
             if ((character == actor) || (character == target)) return false;
-            if (character->combatHandler.charactersInSight.containsCharacter(
-                actor))
-                return true;
+            if (character->areaOfInterest.canSee(actor->room)) return false;
             return character->combatHandler.getAimedTarget() == actor;
         }, actor->getNameCapital(), target->getName(), weapon->getName(true));
 
-    target->room->funcSendToAll(
+    target->room->funcSendToObservers(
         "Something whizzes nearby %s.\n",
         [&](Character * character)
         {
             if ((character == actor) || (character == target)) return false;
-            if (character->combatHandler.charactersInSight.containsCharacter(
-                actor))
-                return false;
+            if (character->areaOfInterest.canSee(actor->room)) return false;
             return character->combatHandler.getAimedTarget() != actor;
         }, target->getName());
 }
@@ -0,0 +1,387 @@
+/// @file   combatArena.cpp
+/// @brief  Implements the arena used to measure the performance of combat.
+/// @author Enrico Fraccaroli
+/// @date   Oct 19 2026
+/// @copyright
+/// Copyright (c) 2016 Enrico Fraccaroli <enrico.fraccaroli@gmail.com>
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///     The above copyright notice and this permission notice shall be included
+///     in all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+
+#include "action/combat/combatArena.hpp"
+
+#include "action/combat/basicAttack.hpp"
+#include "utilities/allocationCounter.hpp"
+#include "utilities/stopwatch.hpp"
+#include "utilities/table.hpp"
+#include "character/mobile.hpp"
+#include "model/itemModel.hpp"
+#include "mud.hpp"
+
+/// The health given to the fighters at the beginning of each round, which
+///  is high enough to survive any round.
+static const unsigned int ArenaVigor = 1000000;
+
+thread_local CombatArena * CombatArena::current = nullptr;
+
+CombatArena::CombatArena() :
+    area(),
+    room(),
+    teams(),
+    fighters(),
+    timings(),
+    rounds(),
+    attacks(),
+    damage(),
+    elapsed(),
+    allocations()
+{
+    area.vnum = -1;
+    area.name = "Arena";
+    area.width = area.height = area.elevation = 1;
+    room.vnum = -1;
+    room.name = "Arena";
+    area.addRoom(&room);
+}
+
+CombatArena::~CombatArena()
+{
+    this->clear();
+}
+
+void CombatArena::addTeam(Race * race,
+                          const unsigned int & size,
+                          const std::shared_ptr<ItemModel> & weapon)
+{
+    teams.emplace_back(ArenaTeam{race, size, weapon});
+}
+
+bool CombatArena::run(const unsigned int & _rounds, std::string & error)
+{
+    if (teams.size() < 2)
+    {
+        error = "There must be at least two teams.";
+        return false;
+    }
+    if (!this->spawn(error))
+    {
+        this->clear();
+        return false;
+    }
+    rounds = attacks = damage = allocations = 0;
+    elapsed = 0;
+    timings.clear();
+    // Reserve the timings now, so that the probes never allocate.
+    timings.reserve(32);
+    std::vector<std::string> messages;
+    current = this;
+    for (unsigned int round = 0; round < _rounds; ++round)
+    {
+        auto allocationsBefore = AllocationCounter::getCount();
+        Stopwatch<std::chrono::microseconds> stopwatch("");
+        for (auto fighter : fighters)
+        {
+            auto & action = fighter->getAction();
+            if (action->getType() != ActionType::Combat)
+            {
+                continue;
+            }
+            auto status = action->perform();
+            if ((status == ActionStatus::Finished) ||
+                (status == ActionStatus::Error))
+            {
+                fighter->popAction();
+            }
+        }
+        for (auto fighter : fighters)
+        {
+            fighter->effectManager.effectUpdate(messages);
+            fighter->effectManager.effectActivate(messages);
+        }
+        elapsed += stopwatch.stop();
+        allocations += AllocationCounter::getCount() - allocationsBefore;
+        // Restore the fighters, outside of the measured section.
+        for (auto fighter : fighters)
+        {
+            damage += ArenaVigor - fighter->health;
+            fighter->health = ArenaVigor;
+            fighter->stamina = ArenaVigor;
+            fighter->message_buffer.clear();
+        }
+        messages.clear();
+        ++rounds;
+    }
+    current = nullptr;
+    this->clear();
+    return true;
+}
+
+void CombatArena::addAttacks(const unsigned int & amount)
+{
+    if (current != nullptr)
+    {
+        current->attacks += amount;
+    }
+}
+
+void CombatArena::addTime(const char * name, const double & duration)
+{
+    if (current == nullptr)
+    {
+        return;
+    }
+    for (auto & it : current->timings)
+    {
+        if (it.name == name)
+        {
+            ++it.calls;
+            it.total += duration;
+            it.longest = std::max(it.longest, duration);
+            return;
+        }
+    }
+    current->timings.emplace_back(ArenaTiming{name, 1, duration, duration});
+}
+
+bool CombatArena::spawn(std::string & error)
+{
+    this->clear();
+    for (size_t team = 0; team < teams.size(); ++team)
+    {
+        auto race = teams[team].race;
+        for (unsigned int it = 0; it < teams[team].size; ++it)
+        {
+            auto fighter = new Mobile();
+            fighter->id = "arena." + ToString(team) + "." + ToString(it);
+            fighter->name = fighter->id;
+            fighter->keys = {"arena", "fighter"};
+            fighter->shortdesc = "An arena fighter is here.";
+            fighter->staticdesc = "an arena fighter";
+            fighter->race = race;
+            if (!Mud::instance().mudFactions.empty())
+            {
+                fighter->faction = Mud::instance().mudFactions.begin()->second;
+            }
+            fighter->weight = 70;
+            fighter->level = 1;
+            for (auto const & ability : race->abilities)
+            {
+                fighter->setAbility(ability.first, ability.second);
+            }
+            for (auto const & skillData : race->skills)
+            {
+                fighter->skillManager.addSkill(skillData->skill,
+                                               skillData->skillLevel);
+            }
+            fighter->health = ArenaVigor;
+            fighter->stamina = ArenaVigor;
+            fighter->respawnRoom = &room;
+            room.addCharacter(fighter);
+            fighters.emplace_back(fighter);
+            if (teams[team].weapon &&
+                !this->equip(fighter, teams[team].weapon, error))
+            {
+                return false;
+            }
+        }
+    }
+    // Let each fighter attack all the fighters of the other teams.
+    size_t first = 0;
+    for (auto const & team : teams)
+    {
+        size_t last = first + team.size;
+        for (size_t it = first; it < last; ++it)
+        {
+            for (size_t other = 0; other < fighters.size(); ++other)
+            {
+                if ((other < first) || (other >= last))
+                {
+                    fighters[it]->combatHandler.addOpponent(fighters[other]);
+                }
+            }
+            fighters[it]->pushAction(
+                std::make_shared<BasicAttack>(fighters[it]));
+        }
+        first = last;
+    }
+    return true;
+}
+
+bool CombatArena::equip(Mobile * fighter,
+                        const std::shared_ptr<ItemModel> & weapon,
+                        std::string & error)
+{
+    if ((weapon->getType() != ModelType::MeleeWeapon) &&
+        (weapon->getType() != ModelType::RangedWeapon))
+    {
+        error = weapon->name + " is not a weapon.";
+        return false;
+    }
+    Material * material = nullptr;
+    for (auto const & it : Mud::instance().mudMaterials)
+    {
+        if (it.second->type == weapon->material)
+        {
+            material = it.second;
+            break;
+        }
+    }
+    auto item = weapon->createItem("arena", material, true);
+    if (item == nullptr)
+    {
+        error = "Cannot create " + weapon->name + ".";
+        return false;
+    }
+    auto bodyParts = fighter->canWield(item, error);
+    if (bodyParts.empty())
+    {
+        delete (item);
+        return false;
+    }
+    item->setOccupiedBodyParts(bodyParts);
+    fighter->addEquipmentItem(item);
+    return true;
+}
+
+void CombatArena::clear()
+{
+    for (auto fighter : fighters)
+    {
+        fighter->combatHandler.resetList();
+    }
+    for (auto fighter : fighters)
+    {
+        // The destructor removes the fighter from the room and deletes its
+        //  temporary items.
+        delete (fighter);
+    }
+    fighters.clear();
+}
+
+ArenaProbe::ArenaProbe(const char * _name) :
+    name(_name),
+    active(CombatArena::isRunning()),
+    start()
+{
+    if (active)
+    {
+        start = std::chrono::high_resolution_clock::now();
+    }
+}
+
+ArenaProbe::~ArenaProbe()
+{
+    if (active)
+    {
+        std::chrono::duration<double, std::micro> duration =
+            std::chrono::high_resolution_clock::now() - start;
+        CombatArena::addTime(name, duration.count());
+    }
+}
+
+bool RunCombatArena(const std::vector<std::string> & args,
+                    std::string & report,
+                    std::string & error)
+{
+    if ((args.size() < 4) || (args.size() > 7))
+    {
+        error = "Usage: radmud --arena (race) (fighters) (race) (fighters) "
+            "[rounds] [weapon] [weapon]";
+        return false;
+    }
+    CombatArena arena;
+    for (size_t team = 0; team < 2; ++team)
+    {
+        auto race = Mud::instance().findRace(ToNumber<int>(args[team * 2]));
+        if (race == nullptr)
+        {
+            error = "Can't find the race " + args[team * 2] + ".";
+            return false;
+        }
+        auto fighters = ToNumber<unsigned int>(args[team * 2 + 1]);
+        if ((fighters == 0) || (fighters > 100))
+        {
+            error = "The teams must have from 1 to 100 fighters.";
+            return false;
+        }
+        std::shared_ptr<ItemModel> weapon;
+        if (args.size() > (5 + team))
+        {
+            auto vnum = ToNumber<int>(args[5 + team]);
+            if (vnum != 0)
+            {
+                weapon = Mud::instance().findItemModel(vnum);
+                if (weapon == nullptr)
+                {
+                    error = "Can't find the model " + args[5 + team] + ".";
+                    return false;
+                }
+            }
+        }
+        arena.addTeam(race, fighters, weapon);
+    }
+    unsigned int rounds = 100;
+    if (args.size() >= 5)
+    {
+        rounds = ToNumber<unsigned int>(args[4]);
+        if ((rounds == 0) || (rounds > 100000))
+        {
+            error = "The rounds must be from 1 to 100000.";
+            return false;
+        }
+    }
+    if (!arena.run(rounds, error))
+    {
+        return false;
+    }
+    // Converts microseconds to milliseconds.
+    auto ToMs = [](const double & value)
+    {
+        return ToString(value / 1000);
+    };
+    auto elapsed = std::max(arena.getElapsed(), 1.0);
+    report = "Rounds      : " + ToString(arena.getRounds()) +
+             " in " + ToMs(elapsed) + " ms (" +
+             ToString(arena.getRounds() * 1000000.0 / elapsed) +
+             " rounds/s)\n";
+    report += "Attacks     : " + ToString(arena.getAttacks()) +
+              " (" + ToString(arena.getDamage()) + " damage)\n";
+    if (AllocationCounter::isEnabled())
+    {
+        report += "Allocations : " +
+                  ToString(static_cast<double>(arena.getAllocations()) /
+                           arena.getRounds()) + " per round\n";
+    }
+    else
+    {
+        report += "Allocations : n/a (build with COUNT_ALLOCATIONS)\n";
+    }
+    Table table;
+    table.addColumn("FUNCTION", align::left);
+    table.addColumn("CALLS", align::right);
+    table.addColumn("TOTAL ms", align::right);
+    table.addColumn("AVG ms", align::right);
+    table.addColumn("MAX ms", align::right);
+    for (auto const & it : arena.getTimings())
+    {
+        table.addRow({it.name,
+                      ToString(it.calls),
+                      ToMs(it.total),
+                      ToMs(it.total / it.calls),
+                      ToMs(it.longest)});
+    }
+    report += table.getTable();
+    return true;
+}
@@ -22,6 +22,7 @@
 
 #include "action/craftAction.hpp"
 
+#include "character/characterUtilities.hpp"
 #include "model/submodel/resourceModel.hpp"
 #include "updater/updater.hpp"
 #include "utilities/logger.hpp"
@@ -117,31 +118,11 @@ bool CraftAction::check(std::string & error) const
         error = "You are too tired right now.";
         return false;
     }
-    // Add the ingredients to the list of items to destroy.
-    for (auto it : production->ingredients)
+    // Check if the reserved ingredients are still available.
+    if (!HasReservedResources(production->ingredients, ingredients))
     {
-        auto required = it.second;
-        for (auto it2 : ingredients)
-        {
-            auto item = it2.first;
-            if (item->getType() == ModelType::Resource)
-            {
-                auto resourceModel = item->model->toResource();
-                if (resourceModel->resourceType == it.first)
-                {
-                    required -= item->quantity;
-                    if (required <= 0)
-                    {
-                        break;
-                    }
-                }
-            }
-        }
-        if (required > 0)
-        {
-            error = "You don't have enough materials.";
-            return false;
-        }
+        error = "You don't have enough materials.";
+        return false;
     }
     return true;
 }
@@ -187,6 +168,7 @@ ActionStatus CraftAction::perform()
         else
         {
             ingredient->quantity -= it.second;
+            ingredient->invalidateWeight();
         }
     }
     // Get the outcome model.
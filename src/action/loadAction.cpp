@@ -123,6 +123,8 @@ ActionStatus LoadAction::perform()
         {
             loadedProjectile->quantity += amount;
             projectile->quantity -= amount;
+            loadedProjectile->invalidateWeight();
+            projectile->invalidateWeight();
             loadedProjectile->updateOnDB();
             projectile->updateOnDB();
         }
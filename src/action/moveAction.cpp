@@ -175,15 +175,12 @@ bool MoveAction::canMoveTo(Character * character,
         // Check if the character is locked into close combat.
         bool lockedInCombat = false;
         // Check if he is in the same room of one of its aggressors.
-        for (auto iterator : character->combatHandler)
+        for (auto const & iterator : character->combatHandler)
         {
-            if (iterator->aggressor != nullptr)
+            if (iterator.aggressor->room == character->room)
             {
-                if (iterator->aggressor->room == character->room)
-                {
-                    lockedInCombat = true;
-                    break;
-                }
+                lockedInCombat = true;
+                break;
             }
         }
         // Check even the aimed character.
@@ -0,0 +1,128 @@
+/// @file   areaOfInterest.cpp
+/// @brief  Implement the class AreaOfInterest.
+/// @author Enrico Fraccaroli
+/// @date   Oct 19 2026
+/// @copyright
+/// Copyright (c) 2016 Enrico Fraccaroli <enrico.fraccaroli@gmail.com>
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///     The above copyright notice and this permission notice shall be included
+///     in all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+
+#include "character/areaOfInterest.hpp"
+
+#include "structure/room.hpp"
+#include "structure/area.hpp"
+
+#include <algorithm>
+
+AreaOfInterest::AreaOfInterest(Character * _owner) :
+    owner(_owner),
+    rooms(),
+    radius()
+{
+    // Nothing to do.
+}
+
+AreaOfInterest::~AreaOfInterest()
+{
+    this->clear();
+}
+
+void AreaOfInterest::update()
+{
+    std::vector<Room *> inSight;
+    radius = owner->getViewDistance();
+    if ((owner->room != nullptr) && (owner->room->area != nullptr))
+    {
+        auto area = owner->room->area;
+        for (auto const & coordinates : area->fov(owner->room->coord, radius))
+        {
+            auto room = area->getRoom(coordinates);
+            if (room != nullptr)
+            {
+                inSight.emplace_back(room);
+            }
+        }
+        std::sort(inSight.begin(), inSight.end());
+    }
+    // Both lists are sorted, walk them together to find the differences.
+    auto previous = rooms.begin();
+    auto current = inSight.begin();
+    while ((previous != rooms.end()) || (current != inSight.end()))
+    {
+        if ((current == inSight.end()) ||
+            ((previous != rooms.end()) && (*previous < *current)))
+        {
+            (*previous++)->removeObserver(owner);
+        }
+        else if ((previous == rooms.end()) || (*current < *previous))
+        {
+            (*current++)->addObserver(owner);
+        }
+        else
+        {
+            ++previous;
+            ++current;
+        }
+    }
+    rooms.swap(inSight);
+}
+
+void AreaOfInterest::refresh()
+{
+    if (radius != owner->getViewDistance())
+    {
+        this->update();
+    }
+}
+
+void AreaOfInterest::clear()
+{
+    for (auto room : rooms)
+    {
+        room->removeObserver(owner);
+    }
+    rooms.clear();
+}
+
+void AreaOfInterest::forget(Room * room)
+{
+    auto it = std::lower_bound(rooms.begin(), rooms.end(), room);
+    if ((it != rooms.end()) && (*it == room))
+    {
+        rooms.erase(it);
+    }
+}
+
+bool AreaOfInterest::canSee(Room * room) const
+{
+    return std::binary_search(rooms.begin(), rooms.end(), room);
+}
+
+CharacterVector AreaOfInterest::getCharactersInSight() const
+{
+    CharacterVector characters;
+    for (auto room : rooms)
+    {
+        for (auto character : room->characters)
+        {
+            if (character != owner)
+            {
+                characters.emplace_back(character);
+            }
+        }
+    }
+    return characters;
+}
@@ -46,6 +46,8 @@ Character::Character() :
     room(),
     inventory(),
     equipment(),
+    inventoryIndex(),
+    equipmentIndex(),
     posture(CharacterPosture::Stand),
     L(luaL_newstate()),
     actionQueue(),
@@ -53,7 +55,13 @@ Character::Character() :
     inputProcessor(std::make_shared<ProcessInput>()),
     effectManager(),
     skillManager(this),
-    combatHandler(this)
+    combatHandler(this),
+    combatProfile(this),
+    areaOfInterest(this),
+    messageMark(),
+    ticMessages(),
+    carryingWeight(),
+    carryingWeightValid()
 {
     // Initialize the action queue.
     this->resetActionQueue();
@@ -276,6 +284,7 @@ bool Character::setAbility(const Ability & ability, const unsigned int & value)
     if (value <= 60)
     {
         abilities[ability] = value;
+        combatProfile.invalidate();
         return true;
     }
     return false;
@@ -603,8 +612,12 @@ Item * Character::findItemAtBodyPart(
 
 void Character::addInventoryItem(Item *& item)
 {
+    // Take the weight before the item gets merged into an existing stack.
+    auto itemWeight = item->getWeight(true);
     // Add the item to the inventory.
     inventory.push_back_item(item);
+    inventoryIndex.add(item);
+    this->addCarryingWeight(itemWeight);
     // Set the owner of the item.
     item->owner = this;
     // Log it.
@@ -616,8 +629,13 @@ void Character::addInventoryItem(Item *& item)
 
 void Character::addEquipmentItem(Item *& item)
 {
+    // Take the weight before the item gets merged into an existing stack.
+    auto itemWeight = item->getWeight(true);
     // Add the item to the equipment.
     equipment.push_back_item(item);
+    equipmentIndex.add(item);
+    combatProfile.invalidate();
+    this->addCarryingWeight(itemWeight);
     // Set the owner of the item.
     item->owner = this;
     // Log it.
@@ -633,6 +651,8 @@ bool Character::remInventoryItem(Item * item)
     {
         return false;
     }
+    inventoryIndex.remove(item);
+    this->addCarryingWeight(-item->getWeight(true));
     // Clear the owner of the item.
     item->owner = nullptr;
     // Log it.
@@ -649,6 +669,9 @@ bool Character::remEquipmentItem(Item * item)
     {
         return false;
     }
+    equipmentIndex.remove(item);
+    combatProfile.invalidate();
+    this->addCarryingWeight(-item->getWeight(true));
     // Clear the owner of the item.
     item->owner = nullptr;
     // Empty the occupied body parts.
@@ -668,16 +691,56 @@ bool Character::canCarry(Item * item, unsigned int quantity) const
 
 double Character::getCarryingWeight() const
 {
-    auto carrying = 0.0;
+    if (!carryingWeightValid)
+    {
+        carryingWeight = 0.0;
+        for (auto iterator : inventory)
+        {
+            carryingWeight += iterator->getWeight(true);
+        }
+        for (auto iterator : equipment)
+        {
+            carryingWeight += iterator->getWeight(true);
+        }
+        carryingWeightValid = true;
+    }
+    return carryingWeight;
+}
+
+void Character::addCarryingWeight(double difference)
+{
+    if (carryingWeightValid)
+    {
+        carryingWeight += difference;
+    }
+}
+
+void Character::invalidateCarryingWeight()
+{
+    carryingWeightValid = false;
+}
+
+bool Character::checkCarryingWeight() const
+{
+    bool safe = true;
+    auto expected = 0.0;
     for (auto iterator : inventory)
     {
-        carrying += iterator->getWeight(true);
+        safe &= iterator->checkWeight();
+        expected += iterator->getWeight(true);
     }
     for (auto iterator : equipment)
     {
-        carrying += iterator->getWeight(true);
+        safe &= iterator->checkWeight();
+        expected += iterator->getWeight(true);
     }
-    return carrying;
+    if (carryingWeightValid && !CorrectAssert(std::abs(carryingWeight - expected) < 0.001))
+    {
+        // Discard the wrong value, it will be evaluated again.
+        carryingWeightValid = false;
+        safe = false;
+    }
+    return safe;
 }
 
 double Character::getMaxCarryingWeight() const
@@ -848,26 +911,33 @@ void Character::updateThirst()
 
 void Character::updateExpiredEffects()
 {
-    std::vector<std::string> messages;
-    if (this->effectManager.effectUpdate(messages))
-    {
-        for (const auto & message : messages)
-        {
-            this->sendMsg(message + "\n");
-        }
-    }
+    this->effectManager.effectUpdate(ticMessages);
 }
 
 void Character::updateActivatedEffects()
 {
-    std::vector<std::string> messages;
-    if (this->effectManager.effectActivate(messages))
+    this->effectManager.effectActivate(ticMessages);
+}
+
+void Character::computeTic()
+{
+    this->updateHealth();
+    this->updateStamina();
+    this->updateHunger();
+    this->updateThirst();
+    this->updateExpiredEffects();
+    this->updateActivatedEffects();
+}
+
+void Character::applyTic()
+{
+    for (const auto & message : ticMessages)
     {
-        for (const auto & message : messages)
-        {
-            this->sendMsg(message + "\n");
-        }
+        this->sendMsg(message + "\n");
     }
+    ticMessages.clear();
+    // The effects can change the view distance.
+    this->areaOfInterest.refresh();
 }
 
 std::string Character::getLook()
@@ -953,19 +1023,7 @@ bool Character::canSee(Character * target) const
 
 unsigned int Character::getArmorClass() const
 {
-    unsigned int result = 10;
-    // + AGILITY MODIFIER
-    result += this->getAbilityModifier(Ability::Agility);
-    // + ARMOR BONUS
-    for (auto item : equipment)
-    {
-        if (item->model->getType() == ModelType::Armor)
-        {
-            // Cast the item to armor.
-            result += static_cast<ArmorItem *>(item)->getArmorClass();
-        }
-    }
-    return result;
+    return combatProfile.getArmorClass();
 }
 
 bool Character::canAttackWith(const std::shared_ptr<BodyPart> & bodyPart) const
@@ -1110,14 +1168,20 @@ void Character::sendMsg(const std::string & msg)
     Logger::log(LogLevel::Error, "[SEND_MESSAGE] Msg :" + msg);
 }
 
+void Character::sendMsg(const SharedMessage & msg)
+{
+    this->sendMsg(*msg);
+}
+
+std::string * Character::getOutputBuffer()
+{
+    return nullptr;
+}
+
 void Character::updateTicImpl()
 {
-    this->updateHealth();
-    this->updateStamina();
-    this->updateHunger();
-    this->updateThirst();
-    this->updateExpiredEffects();
-    this->updateActivatedEffects();
+    this->computeTic();
+    this->applyTic();
 }
 
 void Character::updateHourImpl()
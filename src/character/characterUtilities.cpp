@@ -27,6 +27,9 @@
 #include "character/character.hpp"
 #include "utilities/logger.hpp"
 #include "structure/room.hpp"
+#include "mud.hpp"
+
+#include <limits>
 
 std::vector<std::shared_ptr<BodyPart::BodyWeapon>> GetActiveNaturalWeapons(
     Character * character)
@@ -109,78 +112,43 @@ bool FindNearbyResouces(
     std::vector<std::pair<Item *, unsigned int>> & foundResources,
     const SearchOptionsCharacter & searchOptions)
 {
-    // Create a function which checks if the given item is of the required type.
-    auto IsValidResource = [](Item * item, const ResourceType & resourceType)
-    {
-        // Check the pointer to the model.
-        if (item->model == nullptr) return false;
-        // Check if the item is a resource.
-        if (item->model->getType() != ModelType::Resource) return false;
-        // Cast the model to ResourceModel.
-        auto resourceModel = item->model->toResource();
-        // Check if the type of resource is the same.
-        return (resourceModel->resourceType == resourceType);
-    };
-    // Create a function which reduces the required quantity and checks if
-    // the zero has been reached.
-    auto DecrementRequired = [&foundResources](Item * item,
-                                               unsigned int & requiredQuantity)
+    // Create a function which takes the resources of the given type from
+    // the index, until the required quantity has been reached.
+    auto TakeFrom = [&foundResources](const CraftingIndex & index,
+                                      const ResourceType & resourceType,
+                                      unsigned int & requiredQuantity)
     {
-        // Get the available quantity.
-        auto quantityAvailable = item->quantity;
-        // Set the used quantity.
-        auto quantityUsed = quantityAvailable;
-        if (quantityAvailable > requiredQuantity)
+        for (auto item : index.getResources(resourceType))
         {
-            quantityUsed = (quantityAvailable - requiredQuantity);
+            if (requiredQuantity == 0) break;
+            // Use only the quantity which is still required.
+            auto quantityUsed = std::min(item->quantity, requiredQuantity);
+            // Add the item to the list of used resources.
+            foundResources.emplace_back(std::make_pair(item, quantityUsed));
+            // Reduce the quantity needed.
+            requiredQuantity -= quantityUsed;
         }
-        // Add the item to the list of used resources.
-        foundResources.emplace_back(std::make_pair(item, quantityUsed));
-        // Reduce the quantity needed.
-        requiredQuantity -= quantityUsed;
-        // Returns if we've reached the needed quantity.
-        return (requiredQuantity == 0);
     };
     for (auto resource : requiredResources)
     {
         // Quantity of ingredients that has to be found.
         auto quantityNeeded = resource.second;
         // Check if we need to search inside the room.
-        // TODO: Probably I need to check if a given item is not selected twice.
         if (searchOptions.searchInRoom)
         {
-            for (auto item : character->room->items)
-            {
-                // Check if the item is a valid resource.
-                if (!IsValidResource(item, resource.first)) continue;
-                // Decrement the required quantity. If we've reached the
-                // needed quantity stop the loop.
-                if (DecrementRequired(item, quantityNeeded)) break;
-            }
+            TakeFrom(character->room->getCraftingIndex(),
+                     resource.first,
+                     quantityNeeded);
         }
         // Check if we need to search inside the character's equipment.
         if (searchOptions.searchInEquipment)
         {
-            for (auto item : character->equipment)
-            {
-                // Check if the item is a valid resource.
-                if (!IsValidResource(item, resource.first)) continue;
-                // Decrement the required quantity. If we've reached the
-                // needed quantity stop the loop.
-                if (DecrementRequired(item, quantityNeeded)) break;
-            }
+            TakeFrom(character->equipmentIndex, resource.first, quantityNeeded);
         }
         // Check if we need to search inside the character's inventory.
         if (searchOptions.searchInInventory)
         {
-            for (auto item : character->inventory)
-            {
-                // Check if the item is a valid resource.
-                if (!IsValidResource(item, resource.first)) continue;
-                // Decrement the required quantity. If we've reached the
-                // needed quantity stop the loop.
-                if (DecrementRequired(item, quantityNeeded)) break;
-            }
+            TakeFrom(character->inventoryIndex, resource.first, quantityNeeded);
         }
         // If the ingredients are still not enough, return false.
         if (quantityNeeded > 0) return false;
@@ -188,56 +156,75 @@ bool FindNearbyResouces(
     return true;
 }
 
+bool HasReservedResources(
+    const std::map<ResourceType, unsigned int> & requiredResources,
+    const std::vector<std::pair<Item *, unsigned int>> & reservedResources)
+{
+    // Sum the reserved quantities which are still available.
+    std::map<ResourceType, unsigned int> reserved;
+    for (auto const & it : reservedResources)
+    {
+        auto item = it.first;
+        if ((item == nullptr) || (item->getType() != ModelType::Resource))
+        {
+            continue;
+        }
+        // The item could have been partially consumed in the meanwhile.
+        if (item->quantity < it.second)
+        {
+            return false;
+        }
+        reserved[item->model->toResource()->resourceType] += it.second;
+    }
+    for (auto const & it : requiredResources)
+    {
+        auto found = reserved.find(it.first);
+        if ((found == reserved.end()) || (found->second < it.second))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 Item * FindNearbyTool(
     Character * character,
     const ToolType & toolType,
     const ItemVector & exceptions,
     const SearchOptionsCharacter & searchOptions)
 {
-    // Create a function which checks if the given item is of the required type.
-    auto IsValidTool = [toolType, exceptions](Item * item)
+    // Create a function which returns the first tool of the index which is
+    // not inside the exception list.
+    auto FindIn = [&toolType, &exceptions](const CraftingIndex & index)
     {
-        // Check the pointer to the model.
-        if (item->model == nullptr) return false;
-        // Check if the item is a resource.
-        if (item->model->getType() != ModelType::Tool) return false;
-        // Cast the model to ResourceModel.
-        auto toolModel = item->model->toTool();
-        // Check if the type of resource is the same.
-        if (toolModel->toolType != toolType) return false;
-        // Check if the item is inside the exception list.
-        return std::find_if(exceptions.begin(),
-                            exceptions.end(),
-                            [item](Item * exception)
-                            {
-                                return (item->vnum == exception->vnum);
-                            }) == exceptions.end();
+        for (auto item : index.getTools(toolType))
+        {
+            if (std::find_if(exceptions.begin(),
+                             exceptions.end(),
+                             [item](Item * exception)
+                             {
+                                 return (item->vnum == exception->vnum);
+                             }) == exceptions.end())
+            {
+                return item;
+            }
+        }
+        return static_cast<Item *>(nullptr);
     };
+    Item * tool = nullptr;
     if (searchOptions.searchInRoom)
     {
-        for (auto item : character->room->items)
-        {
-            // Check if it is a valid item.
-            if (IsValidTool(item)) return item;
-        }
+        tool = FindIn(character->room->getCraftingIndex());
     }
-    if (searchOptions.searchInEquipment)
+    if ((tool == nullptr) && searchOptions.searchInEquipment)
     {
-        for (auto item : character->equipment)
-        {
-            // Check if it is a valid item.
-            if (IsValidTool(item)) return item;
-        }
+        tool = FindIn(character->equipmentIndex);
     }
-    if (searchOptions.searchInInventory)
+    if ((tool == nullptr) && searchOptions.searchInInventory)
     {
-        for (auto item : character->inventory)
-        {
-            // Check if it is a valid item.
-            if (IsValidTool(item)) return item;
-        }
+        tool = FindIn(character->inventoryIndex);
     }
-    return nullptr;
+    return tool;
 }
 
 bool FindNearbyTools(
@@ -353,4 +340,81 @@ bool HasRequiredKnowledge(Character * character, Production * production)
             return (character->skillManager.getKnowledge(k) > 0) ||
                    (character->effectManager.getKnowledge(k) > 0);
         }) != production->requiredKnowledge.end();
-}
\ No newline at end of file
+}
+
+std::vector<std::pair<Production *, unsigned int>> GetFeasibleProductions(
+    Character * character,
+    Profession * profession)
+{
+    std::vector<std::pair<Production *, unsigned int>> feasible;
+    if (WrongAssert(character == nullptr)) return feasible;
+    if (WrongAssert(character->room == nullptr)) return feasible;
+    auto const & roomIndex = character->room->getCraftingIndex();
+    // The tools and the resources are shared by the productions, count them
+    // only the first time they are required.
+    std::map<ToolType, size_t> availableTools;
+    std::map<ResourceType, unsigned int> availableResources;
+    auto CountTools = [&](const ToolType & toolType)
+    {
+        auto it = availableTools.find(toolType);
+        if (it == availableTools.end())
+        {
+            auto count = roomIndex.getTools(toolType).size() +
+                         character->equipmentIndex.getTools(toolType).size() +
+                         character->inventoryIndex.getTools(toolType).size();
+            it = availableTools.emplace(toolType, count).first;
+        }
+        return it->second;
+    };
+    auto CountResources = [&](const ResourceType & resourceType)
+    {
+        auto it = availableResources.find(resourceType);
+        if (it == availableResources.end())
+        {
+            // The ingredients are never taken from the equipment.
+            auto quantity = roomIndex.getQuantity(resourceType) +
+                            character->inventoryIndex.getQuantity(resourceType);
+            it = availableResources.emplace(resourceType, quantity).first;
+        }
+        return it->second;
+    };
+    for (auto const & it : Mud::instance().mudProductions)
+    {
+        auto production = it.second;
+        if (production->profession != profession) continue;
+        if (!HasRequiredKnowledge(character, production)) continue;
+        // The workbench must be inside the room.
+        if ((production->workbench != ToolType::None) &&
+            roomIndex.getTools(production->workbench).empty())
+        {
+            continue;
+        }
+        // Each required tool must be a different item.
+        std::map<ToolType, size_t> requiredTools;
+        for (auto const & toolType : production->tools)
+        {
+            ++requiredTools[toolType];
+        }
+        bool hasTools = true;
+        for (auto const & tool : requiredTools)
+        {
+            hasTools &= (CountTools(tool.first) >= tool.second);
+        }
+        if (!hasTools) continue;
+        // The tools are not consumed, so the ingredients determine how many
+        // times the production can be executed.
+        auto times = std::numeric_limits<unsigned int>::max();
+        for (auto const & ingredient : production->ingredients)
+        {
+            if (ingredient.second == 0) continue;
+            times = std::min(times,
+                             CountResources(ingredient.first) /
+                             ingredient.second);
+        }
+        if (times > 0)
+        {
+            feasible.emplace_back(production, times);
+        }
+    }
+    return feasible;
+}
@@ -28,10 +28,7 @@ static inline bool IsAnException(
     Character * character,
     std::vector<Character *> const & ex)
 {
-    return
-        std::find_if(
-            ex.begin(), ex.end(), [&character](Character * other)
-            { return other->getName() == character->getName(); }) != ex.end();
+    return std::find(ex.begin(), ex.end(), character) != ex.end();
 }
 
 CharacterVector::CharacterVector()
@@ -45,6 +42,7 @@ Character * CharacterVector::findCharacter(const std::string & target,
                                            bool skipMobile,
                                            bool skipPlayer) const
 {
+    auto key = ToLower(target);
     for (auto character : (*this))
     {
         if ((skipMobile && character->isMobile()) ||
@@ -56,7 +54,7 @@ Character * CharacterVector::findCharacter(const std::string & target,
         // Check if the character is a mobile or a player.
         if (character->isMobile())
         {
-            if (character->toMobile()->hasKey(ToLower(target)))
+            if (character->toMobile()->hasKey(key))
             {
                 if (number == 1) return character->toMobile();
                 --number;
@@ -66,8 +64,7 @@ Character * CharacterVector::findCharacter(const std::string & target,
         {
             if (character->toPlayer()->isPlaying())
             {
-                if (BeginWith(character->toPlayer()->getName(),
-                              ToLower(target)))
+                if (BeginWithNoCase(character->name, key))
                 {
                     if (number == 1) return character->toPlayer();
                     --number;
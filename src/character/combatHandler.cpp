@@ -22,6 +22,8 @@
 
 #include "character/combatHandler.hpp"
 
+#include <algorithm>
+
 #include "structure/room.hpp"
 #include "structure/area.hpp"
 #include "utilities/logger.hpp"
@@ -29,8 +31,13 @@
 CombatHandler::CombatHandler(Character * _owner) :
     owner(_owner),
     opponents(),
+    positions(),
+    engagedBy(),
+    nextSequence(),
     predefinedTarget(),
     aimedCharacter(),
+    targetedBy(),
+    generator(),
     charactersInSight()
 {
     // Nothing to do.
@@ -38,106 +45,122 @@ CombatHandler::CombatHandler(Character * _owner) :
 
 CombatHandler::~CombatHandler()
 {
-    // Nothing to do.
+    // Remove the owner from the handlers which are still fighting it.
+    while (!engagedBy.empty())
+    {
+        auto handler = engagedBy.back();
+        handler->detach(handler->positions.at(owner));
+    }
+    // Remove the owner from the handlers of its opponents.
+    while (!opponents.empty())
+    {
+        this->detach(opponents.size() - 1);
+    }
+    // Clear the references to the owner kept by the other handlers.
+    while (!targetedBy.empty())
+    {
+        auto handler = targetedBy.back();
+        if (handler->predefinedTarget == owner)
+        {
+            handler->retarget(handler->predefinedTarget, nullptr);
+        }
+        if (handler->aimedCharacter == owner)
+        {
+            handler->retarget(handler->aimedCharacter, nullptr);
+        }
+    }
+    // Stop being tracked by the handlers of the targets.
+    this->retarget(predefinedTarget, nullptr);
+    this->retarget(aimedCharacter, nullptr);
 }
 
 bool CombatHandler::addOpponent(Character * character, unsigned int initAggro)
 {
-    if (!this->hasOpponent(character))
+    if (this->hasOpponent(character))
     {
-        if (initAggro == 0)
-        {
-            initAggro = this->getInitialAggro(character);
-        }
-        // Add the aggressor.
-        opponents.push_back(std::make_shared<Aggression>(character, initAggro));
-        // Sort the list.
-        this->sortList();
-        Logger::log(LogLevel::Debug, "%s engage %s with %s.",
-                    owner->getNameCapital(),
-                    character->getName(),
-                    initAggro);
-        this->printList();
-        return true;
+        return false;
     }
-    return false;
+    if (initAggro == 0)
+    {
+        initAggro = this->getInitialAggro(character);
+    }
+    // When the combat starts, seed its generator and record the seed, so that
+    // the whole combat can be replayed.
+    if (opponents.empty())
+    {
+        auto label = "combat " + owner->getName();
+        auto seed = Random::drawSeed(label);
+        generator.seed(seed);
+        Random::record(label, seed);
+    }
+    // Add the aggressor at the bottom of the heap, then move it up.
+    opponents.emplace_back(character, initAggro, nextSequence++);
+    positions[character] = opponents.size() - 1;
+    this->siftUp(opponents.size() - 1);
+    // Let the aggressor know that the owner is fighting it.
+    character->combatHandler.engagedBy.emplace_back(this);
+    Logger::log(LogLevel::Debug, "%s engage %s with %s.",
+                owner->getNameCapital(),
+                character->getName(),
+                initAggro);
+    return true;
 }
 
 bool CombatHandler::remOpponent(Character * character)
 {
-    for (auto it = opponents.begin(); it != opponents.end(); ++it)
+    auto it = positions.find(character);
+    if (it == positions.end())
+    {
+        Logger::log(LogLevel::Debug,
+                    "Cannot find %s among the aggressors of %s",
+                    character->getName(),
+                    owner->getNameCapital());
+        return false;
+    }
+    // Remove the opponent.
+    this->detach(it->second);
+    // Check if the opponent is currently the aimed character.
+    if (aimedCharacter == character)
+    {
+        this->setAimedTarget(nullptr);
+    }
+    // Check if the opponent is currently the predefined target.
+    if (predefinedTarget == character)
+    {
+        this->setPredefinedTarget(nullptr);
+    }
+    Logger::log(LogLevel::Debug,
+                "%s disengages %s",
+                owner->getNameCapital(),
+                character->getName());
+    // If the list of opponents is empty, stop the fighting.
+    if (this->empty())
     {
-        auto aggression = (*it);
-        if (aggression->aggressor->name == character->name)
+        auto action = owner->getAction();
+        if (action->getType() == ActionType::Combat)
         {
-            // Remove the opponent.
-            opponents.erase(it);
-            // Check if the opponent is currently the aimed character.
-            if (aimedCharacter != nullptr)
-            {
-                if (aimedCharacter->name == aggression->aggressor->name)
-                {
-                    aimedCharacter = nullptr;
-                }
-            }
-            // Check if the opponent is currently the predefined target.
-            if (predefinedTarget != nullptr)
-            {
-                if (predefinedTarget->name == aggression->aggressor->name)
-                {
-                    predefinedTarget = nullptr;
-                }
-            }
-            Logger::log(LogLevel::Debug,
-                        "%s disengages %s",
-                        owner->getNameCapital(),
-                        character->getName());
-            this->printList();
-            // If the list of opponents is empty, stop the fighting.
-            if (this->empty())
-            {
-                auto action = owner->getAction();
-                if (action->getType() == ActionType::Combat)
-                {
-                    auto combatAction = action->toCombatAction();
-                    combatAction->handleStop();
-                }
-            }
-            return true;
+            auto combatAction = action->toCombatAction();
+            combatAction->handleStop();
         }
     }
-    Logger::log(LogLevel::Debug,
-                "Cannot find %s among the aggressors of %s",
-                character->getName(),
-                owner->getNameCapital());
-    this->printList();
-    return false;
+    return true;
 }
 
 bool CombatHandler::hasOpponent(Character * character)
 {
-    return std::find_if(
-        opponents.begin(), opponents.end(),
-        [&](std::shared_ptr<Aggression> const & element)
-        {
-            return element->aggressor->name == character->name;
-        }) != opponents.end();
+    return positions.find(character) != positions.end();
 }
 
 void CombatHandler::updateCharactersInSight()
 {
     // Get the characters in sight.
-    CharacterVector exceptions;
-    exceptions.emplace_back(owner);
-    charactersInSight = owner->room->area->getCharactersInSight(
-        exceptions,
-        owner->room->coord,
-        owner->getViewDistance());
+    owner->areaOfInterest.refresh();
+    charactersInSight = owner->areaOfInterest.getCharactersInSight();
 }
 
 void CombatHandler::setPredefinedTarget(Character * character)
 {
-    predefinedTarget = character;
+    this->retarget(predefinedTarget, character);
 }
 
 Character * CombatHandler::getPredefinedTarget()
@@ -147,7 +170,7 @@ Character * CombatHandler::getPredefinedTarget()
 
 void CombatHandler::setAimedTarget(Character * character)
 {
-    aimedCharacter = character;
+    this->retarget(aimedCharacter, character);
 }
 
 Character * CombatHandler::getAimedTarget()
@@ -157,33 +180,34 @@ Character * CombatHandler::getAimedTarget()
 
 bool CombatHandler::setAggro(Character * character, unsigned int newAggression)
 {
-    bool ret = false;
-    auto it = std::find_if(
-        opponents.begin(), opponents.end(),
-        [&](std::shared_ptr<Aggression> const & p)
-        {
-            return p->aggressor->name == character->name;
-        });
-    if (it != opponents.end())
+    auto it = positions.find(character);
+    if (it == positions.end())
+    {
+        return false;
+    }
+    auto position = it->second;
+    auto oldAggression = opponents[position].aggression;
+    // Set the new aggro.
+    opponents[position].aggression = newAggression;
+    // Restore the order of the heap.
+    if (newAggression > oldAggression)
+    {
+        this->siftUp(position);
+    }
+    else
     {
-        // Set the new aggro.
-        (*it)->aggression = newAggression;
-        // Sort the list.
-        this->sortList();
-        this->printList();
-        // Set return value to success.
-        ret = true;
+        this->siftDown(position);
     }
-    return ret;
+    return true;
 }
 
-std::shared_ptr<CombatHandler::Aggression> CombatHandler::getTopAggro()
+const CombatHandler::Aggression * CombatHandler::getTopAggro() const
 {
     if (opponents.empty())
     {
         return nullptr;
     }
-    return opponents.front();
+    return &opponents.front();
 }
 
 bool CombatHandler::moveToTopAggro(Character * character)
@@ -193,28 +217,14 @@ bool CombatHandler::moveToTopAggro(Character * character)
     {
         return false;
     }
-    auto topAggressor = this->getTopAggro();
-    if (topAggressor == nullptr)
-    {
-        return false;
-    }
     // Check if the character is already the top aggro.
+    auto topAggressor = this->getTopAggro();
     if (topAggressor->aggressor == character)
     {
         return false;
     }
-    // Retrieve the top aggro.
-    auto currentAggro = this->getAggro(character);
-    auto topAggro = currentAggro;
-    for (auto it : opponents)
-    {
-        if (it->aggression > topAggro)
-        {
-            topAggro = it->aggression;
-        }
-    }
     // Just set the aggro of the character enough to be put on the first place.
-    this->setAggro(character, topAggro + 1);
+    this->setAggro(character, topAggressor->aggression + 1);
     return true;
 }
 
@@ -229,14 +239,12 @@ unsigned int CombatHandler::getInitialAggro(Character * character)
 
 unsigned int CombatHandler::getAggro(Character * character)
 {
-    for (auto it : opponents)
+    auto it = positions.find(character);
+    if (it == positions.end())
     {
-        if (it->aggressor == character)
-        {
-            return it->aggression;
-        }
+        return 0;
     }
-    return 0;
+    return opponents[it->second].aggression;
 }
 
 std::size_t CombatHandler::getSize()
@@ -251,86 +259,173 @@ bool CombatHandler::empty()
 
 void CombatHandler::checkList()
 {
-    auto temporaryList = opponents;
-    for (auto it = temporaryList.begin(); it != temporaryList.end(); ++it)
+    std::vector<Character *> absent;
+    for (auto const & it : opponents)
     {
-        // Check if the aggressor is null.
-        if ((*it)->aggressor == nullptr)
+        // Check if the aggressor is nowhere.
+        if (it.aggressor->room == nullptr)
         {
-            this->remOpponent((*it)->aggressor);
-        }
-            // Check if the aggressor is nowhere.
-        else if ((*it)->aggressor->room == nullptr)
-        {
-            this->remOpponent((*it)->aggressor);
+            absent.emplace_back(it.aggressor);
         }
     }
+    for (auto aggressor : absent)
+    {
+        this->remOpponent(aggressor);
+    }
 }
 
 void CombatHandler::resetList()
 {
-    for (auto it : opponents)
+    // Remove the owner from the lists of the characters which are fighting
+    // it, working on a copy since the list shrinks while doing so.
+    auto handlers = engagedBy;
+    for (auto handler : handlers)
     {
-        if (it->aggressor == nullptr)
+        if (!handler->remOpponent(owner))
         {
-            Logger::log(LogLevel::Error, "Found a nullptr aggressor.");
-        }
-        else
-        {
-            // Remove the owner from its list.
-            if (it->aggressor->combatHandler.remOpponent(owner))
-            {
-                Logger::log(LogLevel::Debug,
-                            "%s disengages %s",
-                            owner->getNameCapital(),
-                            it->aggressor->getName());
-            }
-            else
-            {
-                Logger::log(LogLevel::Error,
-                            "Could not remove %s from opponents of %s.",
-                            owner->getName(),
-                            it->aggressor->getName());
-            }
+            Logger::log(LogLevel::Error,
+                        "Could not remove %s from opponents of %s.",
+                        owner->getName(),
+                        handler->owner->getName());
         }
     }
-    opponents.clear();
+    while (!opponents.empty())
+    {
+        this->detach(opponents.size() - 1);
+    }
     // Clear the predefined target.
     this->setPredefinedTarget(nullptr);
     // Clear the aimed character.
     this->setAimedTarget(nullptr);
 }
 
-std::vector<std::shared_ptr<CombatHandler::Aggression> >::iterator
-CombatHandler::begin()
+std::vector<CombatHandler::Aggression>
+CombatHandler::getSortedOpponents() const
+{
+    auto sorted = opponents;
+    std::sort(sorted.begin(), sorted.end(), &CombatHandler::precedes);
+    return sorted;
+}
+
+std::vector<CombatHandler::Aggression>::const_iterator
+CombatHandler::begin() const
 {
     return opponents.begin();
 }
 
-std::vector<std::shared_ptr<CombatHandler::Aggression> >::iterator
-CombatHandler::end()
+std::vector<CombatHandler::Aggression>::const_iterator
+CombatHandler::end() const
 {
     return opponents.end();
 }
 
-void CombatHandler::sortList()
+bool CombatHandler::precedes(const Aggression & a, const Aggression & b)
 {
-    std::sort(
-        opponents.begin(), opponents.end(),
-        [](const std::shared_ptr<Aggression> & a,
-           const std::shared_ptr<Aggression> & b)
+    if (a.aggression != b.aggression)
+    {
+        return a.aggression > b.aggression;
+    }
+    return a.sequence < b.sequence;
+}
+
+void CombatHandler::siftUp(size_t position)
+{
+    auto aggression = std::move(opponents[position]);
+    while (position > 0)
+    {
+        auto parent = (position - 1) / 2;
+        if (!CombatHandler::precedes(aggression, opponents[parent]))
         {
-            return a->aggression > b->aggression;
-        });
+            break;
+        }
+        this->place(std::move(opponents[parent]), position);
+        position = parent;
+    }
+    this->place(std::move(aggression), position);
 }
 
-void CombatHandler::printList()
+void CombatHandler::siftDown(size_t position)
 {
-    std::cout << "Aggro List:" << std::endl;
-    for (auto it : opponents)
+    auto aggression = std::move(opponents[position]);
+    while (true)
+    {
+        auto child = 2 * position + 1;
+        if (child >= opponents.size())
+        {
+            break;
+        }
+        if (((child + 1) < opponents.size()) &&
+            CombatHandler::precedes(opponents[child + 1], opponents[child]))
+        {
+            ++child;
+        }
+        if (!CombatHandler::precedes(opponents[child], aggression))
+        {
+            break;
+        }
+        this->place(std::move(opponents[child]), position);
+        position = child;
+    }
+    this->place(std::move(aggression), position);
+}
+
+void CombatHandler::place(Aggression && aggression, const size_t & position)
+{
+    positions[aggression.aggressor] = position;
+    opponents[position] = std::move(aggression);
+}
+
+void CombatHandler::detach(const size_t & position)
+{
+    auto aggressor = opponents[position].aggressor;
+    positions.erase(aggressor);
+    // Fill the hole with the last opponent, then restore the heap.
+    auto last = opponents.size() - 1;
+    if (position != last)
+    {
+        this->place(std::move(opponents[last]), position);
+        opponents.pop_back();
+        this->siftDown(position);
+        this->siftUp(position);
+    }
+    else
+    {
+        opponents.pop_back();
+    }
+    // Remove the back-reference from the handler of the aggressor.
+    auto & handlers = aggressor->combatHandler.engagedBy;
+    auto it = std::find(handlers.begin(), handlers.end(), this);
+    if (it != handlers.end())
+    {
+        *it = handlers.back();
+        handlers.pop_back();
+    }
+}
+
+void CombatHandler::retarget(Character *& target, Character * character)
+{
+    auto previous = target;
+    if (previous == character)
+    {
+        return;
+    }
+    target = character;
+    auto other = (&target == &predefinedTarget) ? aimedCharacter :
+                 predefinedTarget;
+    // Stop tracking the previous target, unless it is still referenced.
+    if ((previous != nullptr) && (previous != other))
+    {
+        auto & handlers = previous->combatHandler.targetedBy;
+        auto it = std::find(handlers.begin(), handlers.end(), this);
+        if (it != handlers.end())
+        {
+            *it = handlers.back();
+            handlers.pop_back();
+        }
+    }
+    // Track the new target, unless it is already tracked.
+    if ((character != nullptr) && (character != other))
     {
-        std::cout
-            << "  [" + (*it).aggressor->name + "] " + ToString((*it).aggression)
-            << std::endl;
+        character->combatHandler.targetedBy.emplace_back(this);
     }
 }
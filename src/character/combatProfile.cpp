@@ -0,0 +1,114 @@
+/// @file   combatProfile.cpp
+/// @brief  Implement the class CombatProfile.
+/// @author Enrico Fraccaroli
+/// @date   Oct 19 2026
+/// @copyright
+/// Copyright (c) 2016 Enrico Fraccaroli <enrico.fraccaroli@gmail.com>
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///     The above copyright notice and this permission notice shall be included
+///     in all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+
+#include "character/combatProfile.hpp"
+#include "character/characterUtilities.hpp"
+#include "item/subitem/armorItem.hpp"
+
+CombatProfile::CombatProfile(Character * _owner) :
+    owner(_owner),
+    valid(),
+    effectsVersion(),
+    meleeWeapons(),
+    rangedWeapons(),
+    naturalWeapons(),
+    armors(),
+    agilityModifier(),
+    baseStamina()
+{
+    // Nothing to do.
+}
+
+CombatProfile::~CombatProfile()
+{
+    // Nothing to do.
+}
+
+void CombatProfile::invalidate()
+{
+    valid = false;
+}
+
+const std::vector<MeleeWeaponItem *> & CombatProfile::getMeleeWeapons() const
+{
+    this->refresh();
+    return meleeWeapons;
+}
+
+const std::vector<RangedWeaponItem *> & CombatProfile::getRangedWeapons() const
+{
+    this->refresh();
+    return rangedWeapons;
+}
+
+const std::vector<std::shared_ptr<BodyPart::BodyWeapon>> &
+CombatProfile::getNaturalWeapons() const
+{
+    this->refresh();
+    return naturalWeapons;
+}
+
+unsigned int CombatProfile::getArmorClass() const
+{
+    this->refresh();
+    // BASE + AGILITY MODIFIER + ARMOR BONUS
+    unsigned int result = 10 + agilityModifier;
+    for (auto armor : armors)
+    {
+        result += armor->getArmorClass();
+    }
+    return result;
+}
+
+unsigned int CombatProfile::getBaseStamina() const
+{
+    this->refresh();
+    return baseStamina;
+}
+
+void CombatProfile::refresh() const
+{
+    if (valid && (effectsVersion == owner->effectManager.getVersion()))
+    {
+        return;
+    }
+    meleeWeapons = GetActiveWeapons<MeleeWeaponItem>(owner);
+    rangedWeapons = GetActiveWeapons<RangedWeaponItem>(owner);
+    naturalWeapons = GetActiveNaturalWeapons(owner);
+    armors.clear();
+    for (auto item : owner->equipment)
+    {
+        if (item->model->getType() == ModelType::Armor)
+        {
+            armors.emplace_back(static_cast<ArmorItem *>(item));
+        }
+    }
+    agilityModifier = owner->getAbilityModifier(Ability::Agility);
+    // BASE     [+1.0]
+    // STRENGTH [-0.0 to -1.40]
+    // WEIGHT   [+1.6 to +2.51]
+    baseStamina = 1;
+    baseStamina -= owner->getAbilityLog(Ability::Strength);
+    baseStamina = SafeSum(baseStamina, SafeLog10(owner->weight));
+    effectsVersion = owner->effectManager.getVersion();
+    valid = true;
+}
@@ -21,11 +21,13 @@
 /// DEALINGS IN THE SOFTWARE.
 
 #include "character/effect/effectManager.hpp"
+#include "action/combat/combatArena.hpp"
 
 EffectManager::EffectManager() :
     activeEffects(),
     pendingEffects(),
-    passiveEffects()
+    passiveEffects(),
+    version()
 {
     // Nothing to do.
 }
@@ -60,6 +62,7 @@ bool EffectManager::addPassiveEffect(const Effect & effect)
     // Activate the effect.
 //    this->addEffectMod(effect);
     (*this) += effect;
+    ++version;
     return true;
 }
 
@@ -73,6 +76,7 @@ void EffectManager::removePassiveEffect(const Effect & effect)
             // Deactivate the effect.
 //            this->remEffectMod(*it);
             (*this) -= (*it);
+            ++version;
             // Remove the effect from the list of active effects.
             passiveEffects.erase(it);
             // Stop the loop.
@@ -89,6 +93,7 @@ void EffectManager::removeAllPassiveEffect()
         // Deactivate the effect.
 //        this->remEffectMod(*it);
         (*this) -= (*it);
+        ++version;
         // Remove the effect from the list of active effects.
         it = passiveEffects.erase(it);
     }
@@ -116,6 +121,7 @@ void EffectManager::forceAddEffect(const Effect & effect)
     // Activate the effect.
 //    this->addEffectMod(effect);
     (*this) += effect;
+    ++version;
     // Sort the list of active effects.
     this->sortEffects(activeEffects);
 }
@@ -168,6 +174,7 @@ bool EffectManager::effectActivate(std::vector<std::string> & messages)
             activeEffects.emplace_back(pendingEffect);
             // Activate the effect.
             (*this) += pendingEffect;
+            ++version;
 //            this->addEffectMod(pendingEffect);
         }
     }
@@ -180,6 +187,7 @@ bool EffectManager::effectActivate(std::vector<std::string> & messages)
 
 bool EffectManager::effectUpdate(std::vector<std::string> & messages)
 {
+    ArenaProbe probe("EffectManager::effectUpdate");
     // Iterate trough the active effects.
     auto it = activeEffects.begin();
     while (it != activeEffects.end())
@@ -196,6 +204,7 @@ bool EffectManager::effectUpdate(std::vector<std::string> & messages)
             // Deactivate the effect.
 //            this->remEffectMod(*it);
             (*this) -= (*it);
+            ++version;
             // Remove the effect from the list of active effects.
             it = activeEffects.erase(it);
         }
@@ -25,6 +25,7 @@
 #include "character/behaviour/generalBehaviour.hpp"
 #include "lua/lua_script.hpp"
 #include "utilities/logger.hpp"
+#include "utilities/slabPool.hpp"
 #include "mud.hpp"
 
 Mobile::Mobile() :
@@ -72,6 +73,16 @@ Mobile::~Mobile()
                 this->getNameCapital());
 }
 
+void * Mobile::operator new(size_t size)
+{
+    return SlabAllocator::allocate("Mobile", size);
+}
+
+void Mobile::operator delete(void * pointer, size_t size)
+{
+    SlabAllocator::deallocate("Mobile", pointer, size);
+}
+
 bool Mobile::setAbilities(const std::string & source)
 {
     if (source.empty()) return false;
@@ -116,6 +127,8 @@ void Mobile::respawn()
         }
     }
     equipment.clear();
+    equipmentIndex.clear();
+    combatProfile.invalidate();
     // Delete the models loaded in the inventory.
     for (auto item : inventory)
     {
@@ -125,6 +138,8 @@ void Mobile::respawn()
         }
     }
     inventory.clear();
+    inventoryIndex.clear();
+    this->invalidateCarryingWeight();
     // Intialize the lua state.
     L = luaL_newstate();
     // Load the lua environment.
@@ -214,17 +229,16 @@ std::string Mobile::getName() const
     return ToLower(staticdesc);
 }
 
-bool Mobile::hasKey(const std::string & key) const
+bool Mobile::hasKey(std::string_view key) const
 {
-    bool found = false;
-    for (auto iterator : keys)
+    for (auto const & iterator : keys)
     {
         if (BeginWith(iterator, key))
         {
-            found = true;
+            return true;
         }
     }
-    return found;
+    return false;
 }
 
 bool Mobile::hasAction(const std::string & _action) const
@@ -291,6 +305,8 @@ void Mobile::reloadLua()
         }
     }
     equipment.clear();
+    equipmentIndex.clear();
+    combatProfile.invalidate();
     // Delete the models loaded in the inventory.
     for (auto item : inventory)
     {
@@ -300,6 +316,8 @@ void Mobile::reloadLua()
         }
     }
     inventory.clear();
+    inventoryIndex.clear();
+    this->invalidateCarryingWeight();
     // Completely clear the stack.
     lua_settop(L, 0);
     // Empty the behaviours queue.
@@ -324,6 +342,15 @@ void Mobile::sendMsg(const std::string & msg)
     }
 }
 
+std::string * Mobile::getOutputBuffer()
+{
+    if (controller != NULL)
+    {
+        return controller->getOutputBuffer();
+    }
+    return &message_buffer;
+}
+
 void Mobile::performBehaviour()
 {
     if (behaviourQueue.empty())
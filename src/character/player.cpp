@@ -33,6 +33,8 @@ Player::Player(const int & _socket,
     port(_port),
     address(_address),
     outbuf(),
+    outqueue(),
+    outtail(),
     inbuf(),
     password(),
     age(),
@@ -215,7 +217,7 @@ bool Player::isPlaying() const
 
 bool Player::hasPendingOutput() const
 {
-    return !outbuf.empty();
+    return !outbuf.empty() || !outqueue.empty();
 }
 
 bool Player::updateOnDB()
@@ -380,16 +382,34 @@ void Player::processRead()
 
 void Player::processWrite()
 {
-    //std::vector<unsigned char> check;
-    // We will loop attempting to write all in buffer, until write blocks.
-    while ((psocket != NO_SOCKET_COMMUNICATION) && !outbuf.empty())
+    if (psocket == NO_SOCKET_COMMUNICATION)
+    {
+        return;
+    }
+    if (!outqueue.empty())
     {
         // We attach to the message the player prompt.
         this->sendPrompt();
-
-        // For portability I replace \n with \r\n.
-        FindAndReplace(&outbuf, "\n", "\r\n");
-
+        // Move the queued messages inside the output buffer, replacing
+        // \n with \r\n for portability.
+        for (auto const & message : outqueue)
+        {
+            std::string::size_type begin = 0, end;
+            while ((end = message->find('\n', begin)) != std::string::npos)
+            {
+                outbuf.append(*message, begin, end - begin);
+                outbuf.append("\r\n");
+                begin = end + 1;
+            }
+            outbuf.append(*message, begin, std::string::npos);
+        }
+        outqueue.clear();
+        outtail.reset();
+    }
+    //std::vector<unsigned char> check;
+    // We will loop attempting to write all in buffer, until write blocks.
+    while (!outbuf.empty())
+    {
         // Send a maximum of 4096 at a time.
         size_t iLength = std::min<size_t>(outbuf.size(), BUFSIZE);
 
@@ -411,7 +431,7 @@ void Player::processWrite()
         Mud::instance().getUpdater().updateBandWidth(2, uncompressed.size());
 #else
         // Send to player.
-        ssize_t nWrite = send(psocket, outbuf.c_str(), outbuf.size(),
+        ssize_t nWrite = send(psocket, outbuf.c_str(), iLength,
                               MSG_NOSIGNAL);
 #endif
 #if 0
@@ -442,7 +462,7 @@ void Player::processWrite()
         MudUpdater::instance().updateBandOut(uWritten);
 
         // Remove what we successfully sent from the buffer.
-        outbuf.erase(0, outbuf.size());
+        outbuf.erase(0, uWritten);
 
         // If partial write, exit
         if (uWritten < iLength)
@@ -460,7 +480,24 @@ void Player::processException()
 
 void Player::sendMsg(const std::string & msg)
 {
-    outbuf += msg;
+    this->getOutputBuffer()->append(msg);
+}
+
+void Player::sendMsg(const SharedMessage & msg)
+{
+    outqueue.emplace_back(msg);
+    outtail.reset();
+}
+
+std::string * Player::getOutputBuffer()
+{
+    // Keep on appending to the last message, as long as it is ours.
+    if (!outtail)
+    {
+        outtail = std::make_shared<std::string>();
+        outqueue.emplace_back(outtail);
+    }
+    return outtail.get();
 }
 
 void Player::updateTicImpl()
@@ -23,6 +23,7 @@
 
 #include "character/skill/skillManager.hpp"
 #include "character/character.hpp"
+#include "action/combat/combatArena.hpp"
 #include "utilities/logger.hpp"
 #include "mud.hpp"
 
@@ -161,6 +162,7 @@ void SkillManager::improveStatus(const StatusModifier & statusModifier)
 
 void SkillManager::improveCombat(const CombatModifier & combatModifier)
 {
+    ArenaProbe probe("SkillManager::improveCombat");
     for (auto & skillData : skills)
     {
         // Get the skill.
@@ -459,7 +459,7 @@ bool DoAim(Character * character, ArgumentHandler & args)
         character->sendMsg("Too many arguments.\n");
         return false;
     }
-    if (GetActiveWeapons<RangedWeaponItem>(character).empty())
+    if (character->combatProfile.getRangedWeapons().empty())
     {
         character->sendMsg("You don't have a ranged weapon equipped.\n");
         return false;
@@ -537,7 +537,7 @@ bool DoFire(Character * character, ArgumentHandler & /*args*/)
         return false;
     }
     // Retrieve the active ranged weapons.
-    auto rangedWeapons = GetActiveWeapons<RangedWeaponItem>(character);
+    auto const & rangedWeapons = character->combatProfile.getRangedWeapons();
     // Check if the character has some ranged weapons equipped.
     if (rangedWeapons.empty())
     {
@@ -26,6 +26,9 @@
 #include "action/buildAction.hpp"
 #include "action/craftAction.hpp"
 #include "character/characterUtilities.hpp"
+#include "utilities/table.hpp"
+
+#include <limits>
 
 void LoadCraftingCommands()
 {
@@ -53,6 +56,30 @@ bool DoProfession(Character * character,
         character->sendMsg("Not while you're sleeping.\n");
         return false;
     }
+    // If the argument list is empty show what the character can produce.
+    if (args.empty())
+    {
+        auto feasible = GetFeasibleProductions(character, profession);
+        if (feasible.empty())
+        {
+            character->sendMsg("You can't produce anything here.\n");
+            return true;
+        }
+        Table table;
+        table.addColumn("PRODUCTION", align::left);
+        table.addColumn("OUTCOME", align::left);
+        table.addColumn("TIMES", align::right);
+        for (auto const & it : feasible)
+        {
+            auto times = (it.second == std::numeric_limits<unsigned int>::max())
+                         ? "any" : ToString(it.second);
+            table.addRow({it.first->name,
+                          it.first->outcome->getName(),
+                          times});
+        }
+        character->sendMsg(table.getTable());
+        return true;
+    }
     // Stop any action the character is executing.
     StopAction(character);
     if (args.size() != 1)
@@ -81,7 +81,7 @@ void LoadGeneralCommands()
         "Shows the server statistics.",
         false, true, false));
     Mud::instance().addCommand(std::make_shared<Command>(
-        DoGenerateName, "generate_name", "",
+        DoGenerateName, "generate_name", "(pattern) [amount] [unique]",
         "Generates a random name.",
         false, true, false));
 }
@@ -352,7 +352,7 @@ bool DoHelp(Character * character, ArgumentHandler & args)
         {
             if (it->canUse(character))
             {
-                if (BeginWith(ToLower(it->name), command))
+                if (BeginWithNoCase(it->name, command))
                 {
                     std::string msg;
                     msg += "Showing help for command :" + it->name + "\n";
@@ -674,6 +674,10 @@ bool DoServer(Character * character, ArgumentHandler & /*args*/)
     msg += ToString(Mud::instance().mudItems.size()) + "\n";
     msg += "    Corpses     : ";
     msg += ToString(Mud::instance().mudCorpses.size()) + "\n";
+    msg += "    Ticking     : ";
+    msg += ToString(MudUpdater::instance().getTickingItemsCount()) + "\n";
+    msg += "    Decaying    : ";
+    msg += ToString(MudUpdater::instance().getDecayingItemsCount()) + "\n";
     msg += "    Areas       : ";
     msg += ToString(Mud::instance().mudAreas.size()) + "\n";
     msg += "    Rooms       : ";
@@ -704,12 +708,30 @@ bool DoServer(Character * character, ArgumentHandler & /*args*/)
     return true;
 }
 
+/// The maximum number of names generated at once.
+static const unsigned int MaxGeneratedNames = 1000;
+
 bool DoGenerateName(Character * character, ArgumentHandler & args)
 {
-    if (args.size() != 1)
+    // The amount must be a number and the only option is 'unique'.
+    auto wrongArguments = [&args]()
+    {
+        if ((args.size() < 1) || (args.size() > 3))
+        {
+            return true;
+        }
+        if ((args.size() >= 2) && !IsNumber(args[1].getContent()))
+        {
+            return true;
+        }
+        return (args.size() == 3) && (args[2].getContent() != "unique");
+    };
+    if (wrongArguments())
     {
         std::string help;
         help += "You must provide a pattern.\n";
+        help += "Optionally, the amount of names to generate and 'unique',\n";
+        help += "  to skip the names of the players and the bad names.\n";
         help += "Guide\n";
         help += "\ts - generic syllable\n";
         help += "\tv - vowel\n";
@@ -751,8 +773,40 @@ bool DoGenerateName(Character * character, ArgumentHandler & args)
         character->sendMsg(help + "\n");
         return false;
     }
-    namegen::NameGenerator nameGenerator(args[0].getContent());
-    character->sendMsg("Combinations : %s\n", nameGenerator.combinations());
-    character->sendMsg("Names : %s\n\n", nameGenerator.toString());
+    std::shared_ptr<const namegen::CompiledPattern> pattern;
+    try
+    {
+        pattern = namegen::CompiledPattern::get(args[0].getContent());
+    }
+    catch (const std::invalid_argument & e)
+    {
+        character->sendMsg("%s.\n", e.what());
+        return false;
+    }
+    character->sendMsg("Combinations : %s\n", pattern->combinations());
+    auto amount = (args.size() >= 2) ?
+                  ToNumber<unsigned int>(args[1].getContent()) : 1U;
+    amount = std::min(std::max(amount, 1U), MaxGeneratedNames);
+    if (args.size() == 3)
+    {
+        // Skip the names which are not allowed or already taken.
+        std::unordered_set<std::string> taken;
+        for (auto const & badName : Mud::instance().badNames)
+        {
+            taken.insert(ToLower(badName));
+        }
+        SQLiteDbms::instance().loadPlayerNames(taken);
+        std::string names;
+        for (auto const & name : pattern->generateUnique(amount, taken,
+                                                         amount * 10))
+        {
+            names.append(name).push_back('\n');
+        }
+        character->sendMsg("Names :\n%s\n", names);
+        return true;
+    }
+    std::string names;
+    pattern->generate(names, amount, '\n');
+    character->sendMsg("Names :\n%s\n", names);
     return true;
 }
@@ -48,7 +48,7 @@ void LoadGodCommands()
         "Go to another room.",
         true, true, false));
     Mud::instance().addCommand(std::make_shared<Command>(
-        DoGenerateMap, "mud_generate_map", "",
+        DoGenerateMap, "mud_generate_map", "(height map vnum) [seed]",
         "Generate a map.",
         true, true, false));
     Mud::instance().addCommand(std::make_shared<Command>(
@@ -63,6 +63,32 @@ void LoadGodCommands()
         DoBuildGenerateMap, "mud_build_generated_map", "",
         "Builds a generated map.",
         true, true, false));
+    Mud::instance().addCommand(std::make_shared<Command>(
+        DoMapJobs, "mud_map_jobs", "",
+        "Lists the maps being generated or built.",
+        true, true, false));
+    Mud::instance().addCommand(std::make_shared<Command>(
+        DoCancelMapJob, "mud_cancel_map_job", "(job)",
+        "Cancels the generation of a map.",
+        true, true, false));
+    Mud::instance().addCommand(std::make_shared<Command>(
+        DoProfile, "mud_profile", "[commands|slow|reset|budget (ms)]",
+        "Shows the timings of the mud cycles and of the commands.",
+        true, true, false));
+    Mud::instance().addCommand(std::make_shared<Command>(
+        DoLog, "mud_log", "(level) [lines] [minutes]",
+        "Shows the most recent entries of the log with the given level.",
+        true, true, false));
+    Mud::instance().addCommand(std::make_shared<Command>(
+        DoRandom, "mud_random", "[seed (value)|replay (label) (seed)]",
+        "Shows the seeds used by combat and generation, sets the master seed "
+            "or replays a section with the given seed.",
+        true, true, false));
+    Mud::instance().addCommand(std::make_shared<Command>(
+        DoPools, "mud_pools", "",
+        "Shows the slots used and free inside the pools of items, rooms "
+            "and mobiles.",
+        true, true, false));
     Mud::instance().addCommand(std::make_shared<Command>(
         DoFactionInfo, "faction_information", "(faction vnum)",
         "Provide all the information regarding the given faction.",
@@ -155,7 +181,8 @@ void LoadGodCommands()
         "Show the information about a specific room.",
         true, true, false));
     Mud::instance().addCommand(std::make_shared<Command>(
-        DoRoomList, "room_list", "",
+        DoRoomList, "room_list",
+        "[area:(vnum)] [name:(text)] [terrain:(name)] [page:(number)]",
         "List all the rooms.",
         true, true, false));
     Mud::instance().addCommand(std::make_shared<Command>(
@@ -163,7 +190,8 @@ void LoadGodCommands()
         "Show the information about a specific area.",
         true, true, false));
     Mud::instance().addCommand(std::make_shared<Command>(
-        DoAreaList, "area_list", "",
+        DoAreaList, "area_list",
+        "[name:(text)] [builder:(name)] [page:(number)]",
         "List all the areas.",
         true, true, false));
 
@@ -186,7 +214,9 @@ void LoadGodCommands()
         "Show information about an item.",
         true, true, false));
     Mud::instance().addCommand(std::make_shared<Command>(
-        DoItemList, "item_list", "Type --help for more information.",
+        DoItemList, "item_list",
+        "[name:(text)] [type:(type)] [model:(vnum)] [owner:(name)] "
+            "[room:(vnum)] [area:(vnum)] [page:(number)]",
         "List all the items.",
         true, true, false));
     Mud::instance().addCommand(std::make_shared<Command>(
@@ -194,7 +224,8 @@ void LoadGodCommands()
         "List all the information about a model.",
         true, true, false));
     Mud::instance().addCommand(std::make_shared<Command>(
-        DoModelList, "model_list", "Type --help for more information.",
+        DoModelList, "model_list",
+        "[name:(text)] [type:(type)] [vnum:(vnum)] [page:(number)]",
         "List all the models.",
         true, true, false));
     Mud::instance().addCommand(std::make_shared<Command>(
@@ -209,7 +240,8 @@ void LoadGodCommands()
         "Kill the desired mobile, in the same room.",
         true, true, false));
     Mud::instance().addCommand(std::make_shared<Command>(
-        DoMobileList, "mob_list", "(mobile name)",
+        DoMobileList, "mob_list",
+        "[name:(text)] [id:(text)] [room:(vnum)] [page:(number)]",
         "List all the mobiles.",
         true, true, false));
     Mud::instance().addCommand(std::make_shared<Command>(
@@ -283,3 +315,23 @@ void LoadGodCommands()
         "Materialize some liquid sinde a container.",
         true, true, false));
 }
+
+void SendListingPage(Character * character,
+                     const Table & table,
+                     unsigned int page,
+                     const std::string & usage)
+{
+    // Render the page directly inside the message queued to the character.
+    auto output = std::make_shared<std::string>();
+    table.renderTable(*output);
+    auto pages = (table.getTotalRows() + GodListingPageRows - 1) /
+                 GodListingPageRows;
+    if (pages > 1)
+    {
+        StringBuilder::append(
+            *output,
+            "Page %s of %s (%s rows), use '%s' to see another one.\n",
+            std::max(page, 1U), pages, table.getTotalRows(), usage);
+    }
+    character->sendMsg(SharedMessage(output));
+}
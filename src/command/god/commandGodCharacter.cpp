@@ -58,6 +58,12 @@ bool DoGodInfo(Character * character, ArgumentHandler & args)
     target->getSheet(sheet);
     // Show the seet to character.
     character->sendMsg(sheet.getTable());
+    // Check the cached weights against the carried items.
+    if (!target->checkCarryingWeight())
+    {
+        character->sendMsg("The cached carrying weight was wrong, "
+                               "it will be evaluated again.\n");
+    }
     return true;
 }
 
@@ -163,14 +169,11 @@ bool DoAggroList(Character * character, ArgumentHandler & args)
             return false;
         }
     }
-    for (auto aggressor : targer->combatHandler)
+    for (auto const & aggressor : targer->combatHandler.getSortedOpponents())
     {
-        if (aggressor->aggressor != nullptr)
-        {
-            character->sendMsg("%s\t%s",
-                               ToString(aggressor->aggression),
-                               aggressor->aggressor->getNameCapital());
-        }
+        character->sendMsg("%s\t%s",
+                           ToString(aggressor.aggression),
+                           aggressor.aggressor->getNameCapital());
     }
     return true;
 }
@@ -20,6 +20,7 @@
 /// DEALINGS IN THE SOFTWARE.
 
 #include "command/god/commandGodItem.hpp"
+#include "input/listingFilter.hpp"
 #include "mud.hpp"
 
 bool DoItemCreate(Character * character, ArgumentHandler & args)
@@ -186,39 +187,48 @@ bool DoItemInfo(Character * character, ArgumentHandler & args)
 
 bool DoItemList(Character * character, ArgumentHandler & args)
 {
-    // Variables used to filter the listed items.
-    std::string itemName;
-    std::string typeName;
-    int modelVnum = -1;
-    for (size_t argIt = 0; argIt < args.size(); ++argIt)
+    ListingFilter filter({"name", "type", "model", "owner", "room", "area"});
+    std::string error;
+    if (!filter.parse(args, error))
     {
-        if (args[argIt].getContent() == "--help")
+        character->sendMsg("%s\nUsage: item_list %s\n",
+                           error, filter.getUsage());
+        return false;
+    }
+    // Take the candidates from the most selective index, if any.
+    auto const & index = Mud::instance().mudItemIndex;
+    std::vector<Item *> candidates;
+    if (filter.has("model"))
+    {
+        candidates = index.findByModel(filter.getNumber("model"));
+    }
+    else if (filter.has("name"))
+    {
+        candidates = index.findByName(filter.get("name"));
+    }
+    else if (filter.has("type"))
+    {
+        candidates = index.findByType(filter.get("type"));
+    }
+    else if (filter.has("room"))
+    {
+        auto room = Mud::instance().findRoom(filter.getNumber("room"));
+        if (room != nullptr)
         {
-            std::string help = "Usage:\n";
-            help += "    item_list [options]\n";
-            help += "Options:\n";
-            help += "    -n [string]     Search items with the name which";
-            help += " contains the given string.\n";
-            help += "    -t [type_name]  Search items of the given type.\n";
-            help += "    -m [model_vnum] Search the items of the model";
-            help += " having the given vnum.\n";
-            character->sendMsg(help);
-            return true;
+            candidates.assign(room->items.begin(), room->items.end());
+            std::sort(candidates.begin(), candidates.end(),
+                      [](Item * a, Item * b)
+                      {
+                          return a->vnum < b->vnum;
+                      });
         }
-        if ((argIt + 1) < args.size())
+    }
+    else
+    {
+        candidates.reserve(Mud::instance().mudItems.size());
+        for (auto iterator : Mud::instance().mudItems)
         {
-            if (args[argIt].getContent() == "-n")
-            {
-                itemName = args[argIt + 1].getContent();
-            }
-            if (args[argIt].getContent() == "-t")
-            {
-                typeName = args[argIt + 1].getContent();
-            }
-            if (args[argIt].getContent() == "-m")
-            {
-                modelVnum = ToNumber<int>(args[argIt + 1].getContent());
-            }
+            candidates.emplace_back(iterator.second);
         }
     }
     Table table;
@@ -227,27 +237,27 @@ bool DoItemList(Character * character, ArgumentHandler & args)
     table.addColumn("Type", align::left);
     table.addColumn("Model", align::left);
     table.addColumn("Location", align::left);
-    for (auto iterator : Mud::instance().mudItems)
+    table.setPage(filter.getPage(), GodListingPageRows);
+    for (auto item : candidates)
     {
-        auto item = iterator.second;
-        if (!itemName.empty())
-        {
-            if (item->getName(false).find(itemName) == std::string::npos)
-            {
-                continue;
-            }
-        }
-        if (!typeName.empty())
+        // Check the filters not answered by the index.
+        if (!filter.equals("model", item->model->vnum)) continue;
+        if (!filter.contains("name", item->getNames().name)) continue;
+        if (!filter.beginsWith("type", item->getTypeName())) continue;
+        if (filter.has("owner"))
         {
-            if (!BeginWith(ToLower(item->getTypeName()), ToLower(typeName)))
-            {
-                continue;
-            }
+            if (item->owner == nullptr) continue;
+            if (!filter.contains("owner", item->owner->getName())) continue;
         }
-        if (modelVnum != -1)
+        if (filter.has("room") || filter.has("area"))
         {
-            if (item->model->vnum != modelVnum) continue;
+            if (item->room == nullptr) continue;
+            if (!filter.equals("room", item->room->vnum)) continue;
+            if (item->room->area == nullptr) continue;
+            if (!filter.equals("area", item->room->area->vnum)) continue;
         }
+        // Only count the rows outside of the page.
+        if (table.skipRow()) continue;
         // Prepare the row.
         TableRow row;
         row.push_back(ToString(item->vnum));
@@ -271,9 +281,10 @@ bool DoItemList(Character * character, ArgumentHandler & args)
             row.push_back(" Is nowhere.");
         }
         // Add the row to the table.
-        table.addRow(row);
+        table.addRow(std::move(row));
     }
-    character->sendMsg(table.getTable());
+    SendListingPage(character, table, filter.getPage(),
+                    "item_list [filters] page:(number)");
     return true;
 }
 
@@ -302,39 +313,13 @@ bool DoModelInfo(Character * character, ArgumentHandler & args)
 
 bool DoModelList(Character * character, ArgumentHandler & args)
 {
-    // Variables used to filter the listed items.
-    std::string modelName;
-    std::string modelType;
-    int modelVnum = -1;
-    for (size_t argIt = 0; argIt < args.size(); ++argIt)
+    ListingFilter filter({"name", "type", "vnum"});
+    std::string error;
+    if (!filter.parse(args, error))
     {
-        if (args[argIt].getContent() == "--help")
-        {
-            std::string help = "Usage:\n";
-            help += "    model_list [options]\n";
-            help += "Options:\n";
-            help += "    -n [string]     Search models with the name which";
-            help += " contains the given string.\n";
-            help += "    -t [type_name]  Search models of the given type.\n";
-            help += "    -m [model_vnum] Search models with the given vnum.\n";
-            character->sendMsg(help);
-            return true;
-        }
-        if ((argIt + 1) < args.size())
-        {
-            if (args[argIt].getContent() == "-n")
-            {
-                modelName = args[argIt + 1].getContent();
-            }
-            if (args[argIt].getContent() == "-t")
-            {
-                modelType = args[argIt + 1].getContent();
-            }
-            if (args[argIt].getContent() == "-m")
-            {
-                modelVnum = ToNumber<int>(args[argIt + 1].getContent());
-            }
-        }
+        character->sendMsg("%s\nUsage: model_list %s\n",
+                           error, filter.getUsage());
+        return false;
     }
     Table table;
     table.addColumn("VNUM", align::right);
@@ -342,28 +327,15 @@ bool DoModelList(Character * character, ArgumentHandler & args)
     table.addColumn("TYPE", align::left);
     table.addColumn("BODY PARTS", align::left);
     table.addColumn("FLAGS", align::right);
+    table.setPage(filter.getPage(), GodListingPageRows);
     for (auto iterator : Mud::instance().mudItemModels)
     {
         auto itemModel = iterator.second;
-        if (!modelName.empty())
-        {
-            if (itemModel->name.find(modelName) == std::string::npos)
-            {
-                continue;
-            }
-        }
-        if (!modelType.empty())
-        {
-            if (!BeginWith(ToLower(itemModel->getTypeName()),
-                           ToLower(modelType)))
-            {
-                continue;
-            }
-        }
-        if (modelVnum != -1)
-        {
-            if (itemModel->vnum != modelVnum) continue;
-        }
+        if (!filter.equals("vnum", itemModel->vnum)) continue;
+        if (!filter.contains("name", itemModel->name)) continue;
+        if (!filter.beginsWith("type", itemModel->getTypeName())) continue;
+        // Only count the rows outside of the page.
+        if (table.skipRow()) continue;
         // Prepare the row.
         TableRow row;
         row.push_back(ToString(itemModel->vnum));
@@ -377,9 +349,10 @@ bool DoModelList(Character * character, ArgumentHandler & args)
         row.push_back(bodyParts);
         row.push_back(ToString(itemModel->modelFlags));
         // Add the row to the table.
-        table.addRow(row);
+        table.addRow(std::move(row));
     }
-    character->sendMsg(table.getTable());
+    SendListingPage(character, table, filter.getPage(),
+                    "model_list [filters] page:(number)");
     return true;
 }
 
@@ -20,6 +20,7 @@
 /// DEALINGS IN THE SOFTWARE.
 
 #include "command/god/commandGodMobile.hpp"
+#include "input/listingFilter.hpp"
 #include "mud.hpp"
 
 bool DoMobileKill(Character * character, ArgumentHandler & args)
@@ -45,15 +46,33 @@ bool DoMobileKill(Character * character, ArgumentHandler & args)
     return true;
 }
 
-bool DoMobileList(Character * character, ArgumentHandler & /*args*/)
+bool DoMobileList(Character * character, ArgumentHandler & args)
 {
+    ListingFilter filter({"name", "id", "room"});
+    std::string error;
+    if (!filter.parse(args, error))
+    {
+        character->sendMsg("%s\nUsage: mob_list %s\n",
+                           error, filter.getUsage());
+        return false;
+    }
     Table table;
     table.addColumn("ALIVE", align::center);
     table.addColumn("ID", align::left);
     table.addColumn("NAME", align::left);
     table.addColumn("LOCATION", align::right);
+    table.setPage(filter.getPage(), GodListingPageRows);
     for (auto mobile : Mud::instance().mudMobiles)
     {
+        if (!filter.contains("name", mobile->getName())) continue;
+        if (!filter.contains("id", mobile->id)) continue;
+        if (filter.has("room"))
+        {
+            if (mobile->room == nullptr) continue;
+            if (!filter.equals("room", mobile->room->vnum)) continue;
+        }
+        // Only count the rows outside of the page.
+        if (table.skipRow()) continue;
         // Prepare the row.
         TableRow row;
         row.push_back((mobile->isAlive()) ? "Yes" : "No");
@@ -68,9 +87,10 @@ bool DoMobileList(Character * character, ArgumentHandler & /*args*/)
             row.push_back("Is nowhere.");
         }
         // Add the row to the table.
-        table.addRow(row);
+        table.addRow(std::move(row));
     }
-    character->sendMsg(table.getTable());
+    SendListingPage(character, table, filter.getPage(),
+                    "mob_list [filters] page:(number)");
     return true;
 }
 
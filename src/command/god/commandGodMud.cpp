@@ -23,6 +23,18 @@
 #include "character/characterUtilities.hpp"
 #include "structure/map_generation/mapGenerator.hpp"
 #include "mud.hpp"
+#include "updater/tickProfiler.hpp"
+#include "utilities/slabPool.hpp"
+#include "item/subitem/armorItem.hpp"
+#include "item/subitem/corpseItem.hpp"
+#include "item/subitem/currencyItem.hpp"
+#include "item/subitem/lightItem.hpp"
+#include "item/subitem/liquidContainerItem.hpp"
+#include "item/subitem/magazineItem.hpp"
+#include "item/subitem/meleeWeaponItem.hpp"
+#include "item/subitem/rangedWeaponItem.hpp"
+#include "item/subitem/resourceItem.hpp"
+#include "item/subitem/shopItem.hpp"
 
 bool DoShutdown(Character * character, ArgumentHandler &)
 {
@@ -168,7 +180,7 @@ bool DoSkillList(Character * character, ArgumentHandler & /*args*/)
 bool DoGenerateMap(Character * character, ArgumentHandler & args)
 {
     std::shared_ptr<HeightMap> heightMap = nullptr;
-    if (args.size() == 1)
+    if ((args.size() == 1) || (args.size() == 2))
     {
         heightMap = Mud::instance().findHeightMap(
             ToNumber<unsigned int>(args[0].getContent()));
@@ -183,31 +195,26 @@ bool DoGenerateMap(Character * character, ArgumentHandler & args)
         return false;
     }
     MapGeneratorConfiguration configuration;
-    // Instantiate the map generator.
-    MapGenerator mapGenerator(configuration, heightMap);
-    // Generate the map.
-    auto map = std::make_shared<MapWrapper>();
-    if (!mapGenerator.generateMap(map))
+    // Use the given seed, in order to generate again a previous map.
+    if (args.size() == 2)
     {
-        character->sendMsg("Error while generating the map.");
-        return false;
+        configuration.seed = ToNumber<unsigned int>(args[1].getContent());
     }
-    // Draw the map.
-    std::string drawnMap;
-    for (int y = 0; y < map->getHeight(); ++y)
+    // Start the generation in background, the map is collected by the
+    // updater once it is completed.
+    auto job = std::make_shared<MapGenerationJob>(
+        Mud::instance().getUniqueGeneratedMapVnum(),
+        character->getName(),
+        configuration,
+        heightMap);
+    if (!Mud::instance().addMapJob(job))
     {
-        for (int x = 0; x < map->getWidth(); ++x)
-        {
-            drawnMap += map->getCell(x, y)->getTile();
-        }
-        drawnMap += "\n";
+        character->sendMsg("Error while generating the map.");
+        return false;
     }
-    // First send the configuration.
-    character->sendMsg(configuration.toString());
-    character->sendMsg(drawnMap);
-    character->sendMsg(Formatter::reset());
-    // Add the map to the list of generated maps.
-    Mud::instance().addGeneratedMap(map);
+    job->start();
+    character->sendMsg("Generating the map %s (seed %s)...\n",
+                       job->id, job->getConfiguration().seed);
     return true;
 }
 
@@ -234,19 +241,8 @@ bool DoShowGenerateMap(Character * character, ArgumentHandler & args)
         character->sendMsg("Can't find the generated map '%s'.", vnum);
         return false;
     }
-    auto map = generatedMap->second;
     // Draw the map.
-    std::string drawnMap;
-    for (int y = 0; y < map->getHeight(); ++y)
-    {
-        for (int x = 0; x < map->getWidth(); ++x)
-        {
-            drawnMap += map->getCell(x, y)->getTile();
-        }
-        drawnMap += "\n";
-    }
-    // First send the configuration.
-    character->sendMsg(drawnMap);
+    character->sendMsg(generatedMap->second->drawMap());
     character->sendMsg(Formatter::reset());
     return true;
 }
@@ -266,6 +262,11 @@ bool DoDeleteGenerateMap(Character * character, ArgumentHandler & args)
         return false;
     }
     auto map = generatedMap->second;
+    if (map->isBuilding())
+    {
+        character->sendMsg("The map '%s' is being built.", vnum);
+        return false;
+    }
     Mud::instance().mudGeneratedMaps.erase(generatedMap);
     map->destroy();
     return true;
@@ -287,10 +288,306 @@ bool DoBuildGenerateMap(Character * character, ArgumentHandler & args)
         character->sendMsg("Can't find the generated map '%s'.", vnum);
         return false;
     }
-    if (!generatedMap->second->buildMap(mapName, character->getNameCapital()))
+    // Create the area, its rooms are built by the updater at each cycle.
+    if (!generatedMap->second->beginBuild(mapName,
+                                          character->getNameCapital()))
     {
         character->sendMsg("Can't build the map '%s'.", vnum);
         return false;
     }
+    character->sendMsg("Building the map '%s'...\n", vnum);
+    return true;
+}
+
+bool DoMapJobs(Character * character, ArgumentHandler &)
+{
+    Table table;
+    table.addColumn("MAP", align::center);
+    table.addColumn("OWNER", align::left);
+    table.addColumn("STATUS", align::left);
+    table.addColumn("PROGRESS", align::right);
+    for (auto it : Mud::instance().mudMapJobs)
+    {
+        table.addRow({ToString(it.first),
+                      it.second->owner,
+                      it.second->getStatusString(),
+                      ToString(it.second->getProgress()) + "%"});
+    }
+    for (auto it : Mud::instance().mudGeneratedMaps)
+    {
+        if (!it.second->isBuilding()) continue;
+        table.addRow({ToString(it.first),
+                      it.second->buildArea->builder,
+                      "Building",
+                      ToString(it.second->getBuildProgress()) + "%"});
+    }
+    character->sendMsg(table.getTable());
+    return true;
+}
+
+bool DoCancelMapJob(Character * character, ArgumentHandler & args)
+{
+    if (args.size() != 1)
+    {
+        character->sendMsg("You must provide the vnum of a map job.");
+        return false;
+    }
+    auto vnum = ToNumber<unsigned int>(args[0].getContent());
+    auto job = Mud::instance().mudMapJobs.find(vnum);
+    if (job == Mud::instance().mudMapJobs.end())
+    {
+        character->sendMsg("Can't find the map job '%s'.", vnum);
+        return false;
+    }
+    job->second->cancel();
+    character->sendMsg("Cancelling the generation of map '%s'.\n", vnum);
+    return true;
+}
+
+bool DoProfile(Character * character, ArgumentHandler & args)
+{
+    auto & profiler = TickProfiler::instance();
+    // Converts microseconds to milliseconds.
+    auto ToMs = [](const double & value)
+    {
+        return ToString(value / 1000);
+    };
+    auto option = (args.size() > 0) ? ToLower(args[0].getContent()) : "";
+    if (option == "reset")
+    {
+        profiler.reset();
+        character->sendMsg("The timings have been cleared.\n");
+        return true;
+    }
+    if (option == "budget")
+    {
+        if (args.size() != 2)
+        {
+            character->sendMsg("The budget is %s ms.\n", profiler.getBudget());
+            return true;
+        }
+        auto budget = ToNumber<unsigned int>(args[1].getContent());
+        if (budget == 0)
+        {
+            character->sendMsg("You must provide a valid budget.\n");
+            return false;
+        }
+        profiler.setBudget(budget);
+        character->sendMsg("The budget is now %s ms.\n", budget);
+        return true;
+    }
+    Table table;
+    if (option == "commands")
+    {
+        table.addColumn("COMMAND", align::left);
+        table.addColumn("COUNT", align::right);
+        table.addColumn("AVG ms", align::right);
+        table.addColumn("MAX ms", align::right);
+        for (size_t it = 0; it < TickProfiler::numBuckets; ++it)
+        {
+            table.addColumn(TickProfiler::bucketToString(it), align::right);
+        }
+        for (auto const & it : profiler.getCommandStats())
+        {
+            TableRow row;
+            row.emplace_back(it.first);
+            row.emplace_back(ToString(it.second.count));
+            row.emplace_back(ToMs(it.second.total / it.second.count));
+            row.emplace_back(ToMs(it.second.max));
+            for (auto bucket : it.second.buckets)
+            {
+                row.emplace_back(ToString(bucket));
+            }
+            table.addRow(row);
+        }
+    }
+    else if (option == "slow")
+    {
+        table.addColumn("TIME", align::left);
+        table.addColumn("DURATION ms", align::right);
+        table.addColumn("PHASES", align::left);
+        for (auto const & it : profiler.getSlowTicks())
+        {
+            table.addRow({it.time,
+                          ToMs(it.duration),
+                          TickProfiler::phasesToString(it.phases)});
+        }
+    }
+    else
+    {
+        character->sendMsg("Cycles : %s, average %s ms, max %s ms, "
+                           "budget %s ms.\n",
+                           profiler.getTicks(),
+                           ToMs(profiler.getAverageTick()),
+                           ToMs(profiler.getMaxTick()),
+                           profiler.getBudget());
+        table.addColumn("PHASE", align::left);
+        table.addColumn("AVG ms", align::right);
+        table.addColumn("MAX ms", align::right);
+        auto ticks = std::max(1UL, profiler.getTicks());
+        for (size_t it = 0; it < TickProfiler::numPhases; ++it)
+        {
+            auto phase = static_cast<TickPhase>(it);
+            auto const & stats = profiler.getPhaseStats(phase);
+            table.addRow({TickProfiler::phaseToString(phase),
+                          ToMs(stats.total / ticks),
+                          ToMs(stats.max)});
+        }
+    }
+    character->sendMsg(table.getTable());
+    return true;
+}
+
+bool DoLog(Character * character, ArgumentHandler & args)
+{
+    if ((args.size() < 1) || (args.size() > 3))
+    {
+        character->sendMsg("Usage: mud_log <level> [lines] [minutes]\n");
+        return false;
+    }
+    // Find the level with the given name.
+    auto name = ToLower(args[0].getContent());
+    auto level = LogLevel::Global;
+    bool found = false;
+    for (unsigned int flag = 1; (flag <= 64) && !found; flag <<= 1)
+    {
+        level = Logger::castFromInt(flag);
+        found = (ToLower(Trim(Logger::levelToString(level))) == name);
+    }
+    if (!found)
+    {
+        character->sendMsg("Levels: global, trace, debug, fatal, error, "
+                           "warning, info.\n");
+        return false;
+    }
+    size_t lines = 20;
+    if (args.size() >= 2)
+    {
+        lines = ToNumber<size_t>(args[1].getContent());
+        if (lines == 0)
+        {
+            character->sendMsg("You must provide a valid number of lines.\n");
+            return false;
+        }
+    }
+    time_t since = 0;
+    if (args.size() == 3)
+    {
+        auto minutes = ToNumber<unsigned int>(args[2].getContent());
+        if (minutes == 0)
+        {
+            character->sendMsg("You must provide a valid number of minutes.\n");
+            return false;
+        }
+        since = time(nullptr) - static_cast<time_t>(minutes) * 60;
+    }
+    std::string result;
+    if (!Logger::getLog(level, &result, lines, since) || result.empty())
+    {
+        character->sendMsg("There are no entries.\n");
+        return true;
+    }
+    character->sendMsg(result);
+    return true;
+}
+
+bool DoRandom(Character * character, ArgumentHandler & args)
+{
+    auto option = (args.size() > 0) ? ToLower(args[0].getContent()) : "";
+    if (option == "seed")
+    {
+        if (args.size() != 2)
+        {
+            character->sendMsg("The master seed is %s.\n", Random::getSeed());
+            return true;
+        }
+        auto seed = std::strtoull(args[1].getContent().c_str(), nullptr, 10);
+        Random::seed(seed);
+        character->sendMsg("The master seed is now %s.\n", seed);
+        return true;
+    }
+    if (option == "replay")
+    {
+        if (args.size() < 3)
+        {
+            character->sendMsg("Usage: mud_random replay (label) (seed)\n");
+            return false;
+        }
+        // The label can be made of more words, the seed is the last one.
+        auto label = args[1].getContent();
+        for (size_t it = 2; it < args.size() - 1; ++it)
+        {
+            label += " " + args[it].getContent();
+        }
+        auto seed = std::strtoull(
+            args[args.size() - 1].getContent().c_str(), nullptr, 10);
+        Random::setReplay(label, seed);
+        character->sendMsg("The next '%s' will use the seed %s.\n",
+                           label, seed);
+        return true;
+    }
+    if (!option.empty())
+    {
+        character->sendMsg("Usage: mud_random [seed (value)|replay (label) "
+                           "(seed)]\n");
+        return false;
+    }
+    Table table;
+    table.addColumn("TIME", align::left);
+    table.addColumn("LABEL", align::left);
+    table.addColumn("SEED", align::right);
+    for (auto const & it : Random::getRecords())
+    {
+        char buffer[32];
+        struct tm local;
+        localtime_r(&it.time, &local);
+        strftime(buffer, 32, "%H:%M:%S", &local);
+        table.addRow({buffer, it.label, ToString(it.seed)});
+    }
+    character->sendMsg(table.getTable());
+    return true;
+}
+
+bool DoPools(Character * character, ArgumentHandler &)
+{
+    // The subclasses of a family share the pool of their size, name them.
+    std::map<std::pair<std::string, size_t>, std::string> types;
+    auto addType = [&types](const std::string & family, size_t size,
+                            const std::string & name)
+    {
+        auto & names = types[std::make_pair(family, size)];
+        names += (names.empty() ? "" : ", ") + name;
+    };
+    addType("Item", sizeof(Item), "Item");
+    addType("Item", sizeof(ArmorItem), "Armor");
+    addType("Item", sizeof(ContainerItem), "Container");
+    addType("Item", sizeof(CorpseItem), "Corpse");
+    addType("Item", sizeof(CurrencyItem), "Currency");
+    addType("Item", sizeof(LightItem), "Light");
+    addType("Item", sizeof(LiquidContainerItem), "LiquidContainer");
+    addType("Item", sizeof(MagazineItem), "Magazine");
+    addType("Item", sizeof(MeleeWeaponItem), "MeleeWeapon");
+    addType("Item", sizeof(RangedWeaponItem), "RangedWeapon");
+    addType("Item", sizeof(ResourceItem), "Resource");
+    addType("Item", sizeof(ShopItem), "Shop");
+    addType("Room", sizeof(Room), "Room");
+    addType("Mobile", sizeof(Mobile), "Mobile");
+    Table table;
+    table.addColumn("FAMILY", align::left);
+    table.addColumn("TYPES", align::left);
+    table.addColumn("SIZE", align::right);
+    table.addColumn("LIVE", align::right);
+    table.addColumn("FREE", align::right);
+    table.addColumn("SLABS", align::right);
+    for (auto const & it : SlabAllocator::getStatistics())
+    {
+        table.addRow({it.family,
+                      types[std::make_pair(it.family, it.objectSize)],
+                      ToString(it.slotSize),
+                      ToString(it.live),
+                      ToString(it.free),
+                      ToString(it.slabs)});
+    }
+    character->sendMsg(table.getTable());
     return true;
 }
@@ -20,6 +20,7 @@
 /// DEALINGS IN THE SOFTWARE.
 
 #include "command/god/commandGodStructure.hpp"
+#include "input/listingFilter.hpp"
 #include "structure/structureUtils.hpp"
 #include "character/characterUtilities.hpp"
 #include "structure/algorithms/AStar/aStar.hpp"
@@ -326,20 +327,49 @@ bool DoRoomInfo(Character * character, ArgumentHandler & args)
 
 bool DoRoomList(Character * character, ArgumentHandler & args)
 {
-    Area * area = nullptr;
-    if (args.size() == 1)
+    ListingFilter filter({"area", "name", "terrain"});
+    std::string error;
+    if (!filter.parse(args, error))
     {
-        auto areaVnum = ToNumber<int>(args[0].getOriginal());
-        area = Mud::instance().findArea(areaVnum);
+        character->sendMsg("%s\nUsage: room_list %s\n",
+                           error, filter.getUsage());
+        return false;
     }
-    if (area == nullptr)
+    // Take the rooms from the map of the area, if it is given.
+    std::vector<Room *> rooms;
+    if (filter.has("area"))
     {
-        character->sendMsg("You must provide the vnum of a valid area:\n");
-        for (auto it: Mud::instance().mudAreas)
+        auto area = Mud::instance().findArea(filter.getNumber("area"));
+        if (area == nullptr)
         {
-            character->sendMsg("[%s] %s.\n", it.first, it.second->name);
+            character->sendMsg("You must provide the vnum of a valid area.\n");
+            return false;
+        }
+        for (auto const & it : area->map)
+        {
+            for (auto const & it2 : it.second)
+            {
+                for (auto const & it3 : it2.second)
+                {
+                    if (it3.second != nullptr)
+                    {
+                        rooms.emplace_back(it3.second);
+                    }
+                }
+            }
+        }
+        std::sort(rooms.begin(), rooms.end(), [](Room * a, Room * b)
+        {
+            return a->vnum < b->vnum;
+        });
+    }
+    else
+    {
+        rooms.reserve(Mud::instance().mudRooms.size());
+        for (auto iterator : Mud::instance().mudRooms)
+        {
+            rooms.emplace_back(iterator.second);
         }
-        return false;
     }
     Table table;
     table.addColumn("VNUM", align::center);
@@ -347,10 +377,13 @@ bool DoRoomList(Character * character, ArgumentHandler & args)
     table.addColumn("COORD", align::center);
     table.addColumn("TERRAIN", align::center);
     table.addColumn("NAME", align::left);
-    for (auto iterator : Mud::instance().mudRooms)
+    table.setPage(filter.getPage(), GodListingPageRows);
+    for (auto room : rooms)
     {
-        Room * room = iterator.second;
-        if (room->area->vnum != area->vnum) continue;
+        if (!filter.contains("name", room->name)) continue;
+        if (!filter.beginsWith("terrain", room->terrain->name)) continue;
+        // Only count the rows outside of the page.
+        if (table.skipRow()) continue;
         // Prepare the row.
         TableRow row;
         row.push_back(ToString(room->vnum));
@@ -368,9 +401,10 @@ bool DoRoomList(Character * character, ArgumentHandler & args)
         row.push_back(room->terrain->name);
         row.push_back(room->name);
         // Add the row to the table.
-        table.addRow(row);
+        table.addRow(std::move(row));
     }
-    character->sendMsg(table.getTable());
+    SendListingPage(character, table, filter.getPage(),
+                    "room_list [filters] page:(number)");
     return true;
 }
 
@@ -400,16 +434,29 @@ bool DoAreaInfo(Character * character, ArgumentHandler & args)
     return true;
 }
 
-bool DoAreaList(Character * character, ArgumentHandler & /*args*/)
+bool DoAreaList(Character * character, ArgumentHandler & args)
 {
+    ListingFilter filter({"name", "builder"});
+    std::string error;
+    if (!filter.parse(args, error))
+    {
+        character->sendMsg("%s\nUsage: area_list %s\n",
+                           error, filter.getUsage());
+        return false;
+    }
     Table table;
     table.addColumn("VNUM", align::center);
     table.addColumn("NAME", align::left);
     table.addColumn("BUILDER", align::left);
     table.addColumn("ROOMS", align::center);
+    table.setPage(filter.getPage(), GodListingPageRows);
     for (auto iterator : Mud::instance().mudAreas)
     {
         Area * area = iterator.second;
+        if (!filter.contains("name", area->name)) continue;
+        if (!filter.contains("builder", area->builder)) continue;
+        // Only count the rows outside of the page.
+        if (table.skipRow()) continue;
         // Prepare the row.
         TableRow row;
         row.push_back(ToString(area->vnum));
@@ -417,8 +464,9 @@ bool DoAreaList(Character * character, ArgumentHandler & /*args*/)
         row.push_back(area->builder);
         row.push_back(ToString(area->map.size()));
         // Add the row to the table.
-        table.addRow(row);
+        table.addRow(std::move(row));
     }
-    character->sendMsg(table.getTable());
+    SendListingPage(character, table, filter.getPage(),
+                    "area_list [filters] page:(number)");
     return true;
 }
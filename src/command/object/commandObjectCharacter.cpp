@@ -349,7 +349,7 @@ bool DoRemove(Character * character, ArgumentHandler & args)
         // Check if we have just removed ALL the USED Ranged Weapons.
         if (character->combatHandler.getAimedTarget() != nullptr)
         {
-            if (GetActiveWeapons<RangedWeaponItem>(character).empty())
+            if (character->combatProfile.getRangedWeapons().empty())
             {
                 character->sendMsg("You stop aiming %s.\n",
                                    character->combatHandler
@@ -407,7 +407,7 @@ bool DoRemove(Character * character, ArgumentHandler & args)
     // Check if we have just removed ALL the USED Ranged Weapons.
     if (character->combatHandler.getAimedTarget() != nullptr)
     {
-        if (GetActiveWeapons<RangedWeaponItem>(character).empty())
+        if (character->combatProfile.getRangedWeapons().empty())
         {
             character->sendMsg("You stop aiming %s.\n",
                                character->combatHandler
@@ -441,20 +441,20 @@ bool DoInventory(Character * character, ArgumentHandler & /*args*/)
     table.addColumn("Item", align::left);
     table.addColumn("Quantity", align::right);
     table.addColumn("Weight", align::right);
-    // List all the items in inventory
-    for (auto it : character->inventory)
+    // List all the items in inventory, grouping the equal ones.
+    for (auto const & it : character->inventory.toStack())
     {
         TableRow row;
         if (roomIsLit || inventoryIsLit)
         {
-            row.emplace_back(it->getNameCapital());
-            row.emplace_back(ToString(it->quantity));
-            row.emplace_back(ToString(it->getWeight(true)));
+            row.emplace_back(it.item->getNameCapital());
+            row.emplace_back(ToString(it.quantity));
+            row.emplace_back(ToString(it.weight));
         }
         else
         {
             row.emplace_back("Something");
-            row.emplace_back((it->quantity == 1) ? "One" : "Some");
+            row.emplace_back((it.quantity == 1) ? "One" : "Some");
             row.emplace_back("???");
         }
         table.addRow(row);
@@ -23,6 +23,7 @@
 #include "structure/structureUtils.hpp"
 #include "command/command.hpp"
 #include "structure/room.hpp"
+#include "structure/area.hpp"
 
 bool DoOrganize(Character * character, ArgumentHandler & args)
 {
@@ -62,7 +63,7 @@ bool DoOrganize(Character * character, ArgumentHandler & args)
     auto name = ItemVector::orderToString(order);
     if (args.size() == 1)
     {
-        character->room->items.orderBy(order);
+        character->room->orderItemsBy(order);
         character->sendMsg("You have organized the room by %s.\n", name);
     }
     else if (args.size() == 2)
@@ -82,6 +83,7 @@ bool DoOrganize(Character * character, ArgumentHandler & args)
                 }
                 // Order the content of the container.
                 item->content.orderBy(order);
+                item->contentChanged();
                 // Organize the target container.
                 character->sendMsg("You have organized %s, by %s.\n",
                                    item->getName(true), name);
@@ -165,6 +167,11 @@ bool DoOpen(Character * character, ArgumentHandler & args)
         }
 
         ClearFlag(door->flags, ItemFlag::Closed);
+        // Update the sight of the characters looking through the door.
+        if (destination->area != nullptr)
+        {
+            destination->area->updateSightAround(destination);
+        }
 
         // Display message.
         if (HasFlag(roomExit->flags, ExitFlag::Hidden))
@@ -326,6 +333,11 @@ bool DoClose(Character * character, ArgumentHandler & args)
             return false;
         }
         SetFlag(door->flags, ItemFlag::Closed);
+        // Update the sight of the characters looking through the door.
+        if (destination->area != nullptr)
+        {
+            destination->area->updateSightAround(destination);
+        }
         // Display message.
         if (HasFlag(roomExit->flags, ExitFlag::Hidden))
         {
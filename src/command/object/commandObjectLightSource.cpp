@@ -26,6 +26,7 @@
 #include "item/subitem/lightItem.hpp"
 #include "command/command.hpp"
 #include "structure/room.hpp"
+#include "updater/updater.hpp"
 
 bool DoTurn(Character * character, ArgumentHandler & args)
 {
@@ -109,6 +110,8 @@ bool DoTurn(Character * character, ArgumentHandler & args)
         {
             character->sendMsg("You turn on %s.\n", item->getName(true));
             lightItem->active = true;
+            // Start updating the light source at each TIC.
+            MudUpdater::instance().registerItem(lightItem);
         }
         else
         {
@@ -239,6 +242,8 @@ bool DoKindle(Character * character, ArgumentHandler & args)
                                lightItem->getName(true),
                                ignitionSource->getName(true));
             lightItem->active = true;
+            // Start updating the light source at each TIC.
+            MudUpdater::instance().registerItem(lightItem);
         }
         else
         {
@@ -90,6 +90,7 @@ bool DoDeposit(Character * character, ArgumentHandler & args)
     else
     {
         item->quantity -= quantity;
+        item->invalidateWeight();
         shopBuilding->balance += item->getPrice(false) * quantity;
     }
     return true;
@@ -142,7 +143,7 @@ bool DoBuy(Character * character, ArgumentHandler & args)
     auto shopKeeper = shop->shopKeeper;
 
     // Get the item.
-    auto item = shop->findContent(args[0].getContent(), args[0].getIndex());
+    auto item = shop->findGood(args[0].getContent(), args[0].getIndex());
     // Check the item.
     if (item == nullptr)
     {
@@ -246,6 +247,7 @@ bool DoBuy(Character * character, ArgumentHandler & args)
         else
         {
             coin->quantity -= iterator.second;
+            coin->invalidateWeight();
             coin->updateOnDB();
         }
     }
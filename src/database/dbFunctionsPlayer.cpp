@@ -107,6 +107,21 @@ bool SQLiteDbms::searchPlayer(const std::string & name)
     return outcome;
 }
 
+bool SQLiteDbms::loadPlayerNames(std::unordered_set<std::string> & names)
+{
+    auto result = dbConnection.executeSelect("SELECT name FROM Player;");
+    if (result == nullptr)
+    {
+        return false;
+    }
+    while (result->next())
+    {
+        names.insert(ToLower(result->getNextString()));
+    }
+    result->release();
+    return true;
+}
+
 bool SQLiteDbms::loadPlayerInformation(ResultSet * result, Player * player)
 {
     // Loading status.
@@ -278,6 +293,8 @@ bool SQLiteDbms::loadPlayerItems(Player * player)
         {
             // Add the item to the inventory.
             player->inventory.push_back_item(item);
+            player->inventoryIndex.add(item);
+            player->invalidateCarryingWeight();
             // Set the owner of the item.
             item->owner = player;
         }
@@ -298,6 +315,9 @@ bool SQLiteDbms::loadPlayerItems(Player * player)
             if (!alreadyPresent)
             {
                 player->equipment.push_back_item(item);
+                player->equipmentIndex.add(item);
+                player->combatProfile.invalidate();
+                player->invalidateCarryingWeight();
                 // Set the owner of the item.
                 item->owner = player;
             }
@@ -23,6 +23,7 @@
 #include "utilities/logger.hpp"
 #include "utilities/utils.hpp"
 
+#include <charconv>
 #include <climits>
 
 Argument::Argument(const std::string & _original) :
@@ -40,12 +41,12 @@ Argument::Argument(const std::string & _original) :
     //Logger::log(LogLevel::Debug, "Multiplier :" + ToString(multiplier) + ";");
 }
 
-std::string Argument::getOriginal() const
+const std::string & Argument::getOriginal() const
 {
     return original;
 }
 
-std::string Argument::getContent() const
+const std::string & Argument::getContent() const
 {
     return content;
 }
@@ -69,20 +70,24 @@ void Argument::evaluateIndex()
         auto pos = content.find('.');
         if (pos != std::string::npos)
         {
-            // Extract the digits.
-            auto digits = content.substr(0, pos);
+            // Look at the digits, without copying them.
+            std::string_view digits(content.data(), pos);
             // Check the digits.
             if (IsNumber(digits))
             {
                 // Get the number.
-                auto number = atol(digits.c_str());
-                if (number < INT_MAX)
+                long number = 0;
+                auto result = std::from_chars(digits.data(),
+                                              digits.data() + digits.size(),
+                                              number);
+                if ((result.ec != std::errc::result_out_of_range) &&
+                    (number < INT_MAX))
                 {
                     // Set the number.
                     index = static_cast<int>(number);
                 }
                 // Remove the digits.
-                content = content.substr(pos + 1, content.size());
+                content.erase(0, pos + 1);
             }
         }
     }
@@ -97,20 +102,24 @@ void Argument::evaluateMultiplier()
         auto pos = content.find('*');
         if (pos != std::string::npos)
         {
-            // Extract the digits.
-            auto digits = content.substr(0, pos);
+            // Look at the digits, without copying them.
+            std::string_view digits(content.data(), pos);
             // Check the digits.
             if (IsNumber(digits))
             {
                 // Get the number.
-                auto number = atol(digits.c_str());
-                if (number < INT_MAX)
+                long number = 0;
+                auto result = std::from_chars(digits.data(),
+                                              digits.data() + digits.size(),
+                                              number);
+                if ((result.ec != std::errc::result_out_of_range) &&
+                    (number < INT_MAX))
                 {
                     // Set the number.
                     multiplier = static_cast<unsigned int>(number);
                 }
                 // Remove the digits.
-                content = content.substr(pos + 1, content.size());
+                content.erase(0, pos + 1);
             }
         }
     }
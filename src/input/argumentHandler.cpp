@@ -55,7 +55,7 @@ void ArgumentHandler::evaluateArguments()
     }
 }
 
-std::string ArgumentHandler::getOriginal()
+const std::string & ArgumentHandler::getOriginal() const
 {
     return original;
 }
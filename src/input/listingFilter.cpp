@@ -0,0 +1,118 @@
+/// @file   listingFilter.cpp
+/// @brief  Implements the filters used by the listing commands.
+/// @author Enrico Fraccaroli
+/// @date   Oct 19 2026
+/// @copyright
+/// Copyright (c) 2016 Enrico Fraccaroli <enrico.fraccaroli@gmail.com>
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///     The above copyright notice and this permission notice shall be included
+///     in all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+
+
+#include "input/listingFilter.hpp"
+
+#include "utilities/utils.hpp"
+
+#include <algorithm>
+
+ListingFilter::ListingFilter(std::vector<std::string> _fields) :
+    fields(std::move(_fields)),
+    values()
+{
+    fields.emplace_back("page");
+}
+
+bool ListingFilter::parse(ArgumentHandler & args, std::string & error)
+{
+    for (size_t it = 0; it < args.size(); ++it)
+    {
+        auto term = args[it].getOriginal();
+        auto separator = term.find(':');
+        if ((separator == std::string::npos) || (separator == 0) ||
+            (separator + 1 == term.size()))
+        {
+            error = "Filters must be written as field:value, '" + term +
+                    "' is not.";
+            return false;
+        }
+        auto field = ToLower(term.substr(0, separator));
+        if (std::find(fields.begin(), fields.end(), field) == fields.end())
+        {
+            error = "Unknown filter '" + field + "'.";
+            return false;
+        }
+        values[field] = ToLower(term.substr(separator + 1));
+    }
+    return true;
+}
+
+std::string ListingFilter::getUsage() const
+{
+    std::string usage;
+    for (auto const & field : fields)
+    {
+        usage += (usage.empty() ? "[" : " [") + field + ":(value)]";
+    }
+    return usage;
+}
+
+bool ListingFilter::has(const std::string & field) const
+{
+    return values.find(field) != values.end();
+}
+
+std::string ListingFilter::get(const std::string & field) const
+{
+    auto it = values.find(field);
+    return (it == values.end()) ? std::string() : it->second;
+}
+
+int ListingFilter::getNumber(const std::string & field) const
+{
+    return ToNumber<int>(this->get(field));
+}
+
+unsigned int ListingFilter::getPage() const
+{
+    auto page = this->getNumber("page");
+    return (page > 0) ? static_cast<unsigned int>(page) : 1;
+}
+
+bool ListingFilter::contains(const std::string & field,
+                             const std::string & value) const
+{
+    auto it = values.find(field);
+    if (it == values.end())
+    {
+        return true;
+    }
+    return ToLower(value).find(it->second) != std::string::npos;
+}
+
+bool ListingFilter::beginsWith(const std::string & field,
+                               const std::string & value) const
+{
+    auto it = values.find(field);
+    if (it == values.end())
+    {
+        return true;
+    }
+    return BeginWith(ToLower(value), it->second);
+}
+
+bool ListingFilter::equals(const std::string & field, int value) const
+{
+    return !this->has(field) || (this->getNumber(field) == value);
+}
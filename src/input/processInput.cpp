@@ -24,6 +24,7 @@
 #include "command/crafting.hpp"
 #include "command/movement.hpp"
 #include "mud.hpp"
+#include "updater/tickProfiler.hpp"
 
 ProcessInput::ProcessInput()
 {
@@ -92,7 +93,10 @@ bool ProcessInput::process(Character * character, ArgumentHandler & args)
             }
             else
             {
+                Stopwatch<std::chrono::microseconds> stopwatch("");
                 executionStatus = iterator->handler(character, args);
+                TickProfiler::instance().addCommandTime(iterator->name,
+                                                        stopwatch.stop());
                 done = true;
                 break;
             }
@@ -0,0 +1,120 @@
+/// @file   craftingIndex.cpp
+/// @brief  Implements the index of the tools and of the resources.
+/// @author Enrico Fraccaroli
+/// @date   Oct 19 2026
+/// @copyright
+/// Copyright (c) 2016 Enrico Fraccaroli <enrico.fraccaroli@gmail.com>
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///     The above copyright notice and this permission notice shall be included
+///     in all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+
+#include "item/craftingIndex.hpp"
+
+#include "model/submodel/resourceModel.hpp"
+#include "model/submodel/toolModel.hpp"
+#include "item/item.hpp"
+
+#include <algorithm>
+
+/// The list returned when there are no items of the given type.
+static const std::vector<Item *> NoItems;
+
+CraftingIndex::CraftingIndex() :
+    tools(),
+    resources()
+{
+    // Nothing to do.
+}
+
+void CraftingIndex::add(Item * item)
+{
+    if ((item == nullptr) || (item->model == nullptr))
+    {
+        return;
+    }
+    std::vector<Item *> * bucket = nullptr;
+    if (item->model->getType() == ModelType::Tool)
+    {
+        bucket = &tools[item->model->toTool()->toolType];
+    }
+    else if (item->model->getType() == ModelType::Resource)
+    {
+        bucket = &resources[item->model->toResource()->resourceType];
+    }
+    if (bucket == nullptr)
+    {
+        return;
+    }
+    // The item could have been stacked with one already indexed.
+    if (std::find(bucket->begin(), bucket->end(), item) == bucket->end())
+    {
+        bucket->emplace_back(item);
+    }
+}
+
+void CraftingIndex::remove(Item * item)
+{
+    if ((item == nullptr) || (item->model == nullptr))
+    {
+        return;
+    }
+    std::vector<Item *> * bucket = nullptr;
+    if (item->model->getType() == ModelType::Tool)
+    {
+        auto it = tools.find(item->model->toTool()->toolType);
+        if (it != tools.end()) bucket = &it->second;
+    }
+    else if (item->model->getType() == ModelType::Resource)
+    {
+        auto it = resources.find(item->model->toResource()->resourceType);
+        if (it != resources.end()) bucket = &it->second;
+    }
+    if (bucket != nullptr)
+    {
+        bucket->erase(std::remove(bucket->begin(), bucket->end(), item),
+                      bucket->end());
+    }
+}
+
+void CraftingIndex::clear()
+{
+    tools.clear();
+    resources.clear();
+}
+
+const std::vector<Item *> & CraftingIndex::getTools(
+    const ToolType & toolType) const
+{
+    auto it = tools.find(toolType);
+    return (it == tools.end()) ? NoItems : it->second;
+}
+
+const std::vector<Item *> & CraftingIndex::getResources(
+    const ResourceType & resourceType) const
+{
+    auto it = resources.find(resourceType);
+    return (it == resources.end()) ? NoItems : it->second;
+}
+
+unsigned int CraftingIndex::getQuantity(
+    const ResourceType & resourceType) const
+{
+    unsigned int quantity = 0;
+    for (auto item : this->getResources(resourceType))
+    {
+        quantity += item->quantity;
+    }
+    return quantity;
+}
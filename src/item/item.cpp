@@ -24,6 +24,7 @@
 
 #include "mud.hpp"
 #include "utilities/logger.hpp"
+#include "utilities/slabPool.hpp"
 
 Item::Item() :
     vnum(),
@@ -42,7 +43,10 @@ Item::Item() :
     container(),
     occupiedBodyParts(),
     content(),
-    itemMutex()
+    itemMutex(),
+    names(),
+    contentWeight(),
+    contentWeightValid()
 {
 }
 
@@ -54,6 +58,16 @@ Item::~Item()
                 this->getNameCapital());
 }
 
+void * Item::operator new(size_t size)
+{
+    return SlabAllocator::allocate("Item", size);
+}
+
+void Item::operator delete(void * pointer, size_t size)
+{
+    SlabAllocator::deallocate("Item", pointer, size);
+}
+
 bool Item::check()
 {
     bool safe = true;
@@ -86,6 +100,9 @@ void Item::removeFromMud()
         auto itemOwner = owner;
         if (owner->equipment.removeItem(this))
         {
+            owner->equipmentIndex.remove(this);
+            owner->combatProfile.invalidate();
+            owner->invalidateCarryingWeight();
             Logger::log(LogLevel::Debug,
                         "Removing item '%s' from '%s' equipment.",
                         this->getName(),
@@ -93,6 +110,8 @@ void Item::removeFromMud()
         }
         if (owner->inventory.removeItem(this))
         {
+            owner->inventoryIndex.remove(this);
+            owner->invalidateCarryingWeight();
             Logger::log(LogLevel::Debug,
                         "Removing item '%s' from '%s' inventory.",
                         this->getName(),
@@ -104,6 +123,8 @@ void Item::removeFromMud()
         auto itemContainer = container;
         if (container->content.removeItem(this))
         {
+            itemContainer->invalidateWeight();
+            itemContainer->contentChanged();
             Logger::log(LogLevel::Debug,
                         "Removing item '%s' from container '%s'.",
                         this->getName(),
@@ -273,6 +294,7 @@ Item * Item::removeFromStack(Character * actor, unsigned int & _quantity)
         {
             // Actually reduce the quantity.
             this->quantity -= _quantity;
+            this->invalidateWeight();
             // Update this item, since its quantity has changed.
             this->updateOnDB();
             // Return the new stack.
@@ -283,14 +305,10 @@ Item * Item::removeFromStack(Character * actor, unsigned int & _quantity)
     return this;
 }
 
-bool Item::hasKey(std::string key)
+bool Item::hasKey(const std::string & key) const
 {
-    for (auto iterator : model->keys)
+    for (auto const & name : this->getNames().keys)
     {
-        // Get the name of the item.
-        std::string name = iterator;
-        // Replace the symbols inside name.
-        model->replaceSymbols(name, composition, quality);
         if (BeginWith(name, key))
         {
             return true;
@@ -299,6 +317,11 @@ bool Item::hasKey(std::string key)
     return false;
 }
 
+std::vector<std::string> Item::getKeys() const
+{
+    return this->getNames().keys;
+}
+
 double Item::getDecayRate() const
 {
     return (SafeLog10(maxCondition) / (composition->hardness * 10)) /
@@ -307,23 +330,50 @@ double Item::getDecayRate() const
 
 void Item::triggerDecay()
 {
-    if (!HasFlag(model->modelFlags, ModelFlag::Unbreakable))
+    if (this->decay())
+    {
+        this->breakDown();
+    }
+}
+
+bool Item::canDecay() const
+{
+    return !HasFlag(model->modelFlags, ModelFlag::Unbreakable);
+}
+
+bool Item::needsTic() const
+{
+    return false;
+}
+
+bool Item::decay()
+{
+    if (!this->canDecay())
     {
-        condition -= this->getDecayRate();
-        if (condition < 0)
+        return false;
+    }
+    auto modifier = this->getConditionModifier();
+    condition -= this->getDecayRate();
+    // The price of the item depends on its condition.
+    if ((container != nullptr) && (this->getConditionModifier() != modifier))
+    {
+        container->contentChanged();
+    }
+    return condition < 0;
+}
+
+void Item::breakDown()
+{
+    // Take everything out from the item.
+    if ((this->room != nullptr) && (!this->isEmpty()))
+    {
+        for (auto it: this->content)
         {
-            // Take everything out from the item.
-            if ((this->room != nullptr) && (!this->isEmpty()))
-            {
-                for (auto it: this->content)
-                {
-                    this->room->addItem(it, true);
-                }
-            }
-            // Add the item to the list of items that has to be destroyed.
-            MudUpdater::instance().addItemToDestroy(this);
+            this->room->addItem(it, true);
         }
     }
+    // Add the item to the list of items that has to be destroyed.
+    MudUpdater::instance().addItemToDestroy(this);
 }
 
 double Item::getConditionModifier() const
@@ -374,33 +424,115 @@ double Item::getWeight(bool entireStack) const
     }
     if (!this->isEmpty())
     {
+        totalWeight += this->getContentWeight();
+    }
+    return totalWeight;
+}
+
+double Item::getContentWeight() const
+{
+    if (!contentWeightValid)
+    {
+        contentWeight = 0.0;
         for (auto iterator : content)
         {
-            totalWeight += iterator->getWeight(true);
+            contentWeight += iterator->getWeight(true);
         }
+        contentWeightValid = true;
+    }
+    return contentWeight;
+}
+
+void Item::invalidateWeight()
+{
+    auto item = this;
+    while (true)
+    {
+        item->contentWeightValid = false;
+        if (item->container == nullptr)
+        {
+            break;
+        }
+        item = item->container;
+        item->contentChanged();
+    }
+    if (item->owner != nullptr)
+    {
+        item->owner->invalidateCarryingWeight();
+    }
+}
+
+bool Item::checkWeight() const
+{
+    bool safe = true;
+    auto expected = 0.0;
+    for (auto iterator : content)
+    {
+        safe &= iterator->checkWeight();
+        expected += iterator->getWeight(true);
+    }
+    if (contentWeightValid && !CorrectAssert(std::abs(contentWeight - expected) < 0.001))
+    {
+        // Discard the wrong value, it will be evaluated again.
+        contentWeightValid = false;
+        safe = false;
+    }
+    return safe;
+}
+
+void Item::addContentWeight(double difference)
+{
+    auto item = this;
+    while (true)
+    {
+        if (item->contentWeightValid)
+        {
+            item->contentWeight += difference;
+        }
+        item->contentChanged();
+        if (item->container == nullptr)
+        {
+            break;
+        }
+        item = item->container;
+    }
+    if (item->owner != nullptr)
+    {
+        item->owner->addCarryingWeight(difference);
     }
-    return totalWeight;
 }
 
 std::string Item::getName(bool colored) const
 {
-    std::string itemName = model->getName(composition, quality);
     if (colored)
     {
-        itemName = Formatter::cyan() + itemName + Formatter::reset();
+        return Formatter::cyan() + this->getNames().name + Formatter::reset();
     }
-    return itemName;
+    return this->getNames().name;
 }
 
 std::string Item::getNameCapital(bool colored) const
 {
-    std::string itemName = model->getName(composition, quality);
-    itemName[0] = static_cast<char>(toupper(itemName[0]));
     if (colored)
     {
-        itemName = Formatter::cyan() + itemName + Formatter::reset();
+        return Formatter::cyan() + this->getNames().nameCapital +
+               Formatter::reset();
+    }
+    return this->getNames().nameCapital;
+}
+
+const ItemNames & Item::getNames() const
+{
+    // Take the names again if the material, the quality or the model
+    // have changed since the last time.
+    if ((names == nullptr) ||
+        (names->composition != composition) ||
+        (names->quality != quality) ||
+        (names->version != model->getNamesVersion()))
+    {
+        names = model->getNames(composition, quality);
     }
-    return itemName;
+    return *names;
 }
 
 std::string Item::getDescription()
@@ -465,15 +597,11 @@ double Item::getTotalSpace() const
 
 double Item::getUsedSpace() const
 {
-    auto used = 0.0;
     if (this->isAContainer())
     {
-        for (auto iterator : content)
-        {
-            used += iterator->getWeight(true);
-        }
+        return this->getContentWeight();
     }
-    return used;
+    return 0.0;
 }
 
 double Item::getFreeSpace() const
@@ -496,10 +624,14 @@ bool Item::canContain(Item * item, const unsigned int & amount) const
 
 void Item::putInside(Item *& item, bool updateDB)
 {
+    // Take the weight before the item gets merged into an existing stack.
+    auto itemWeight = item->getWeight(true);
     // Put the item inside the container.
     content.push_back_item(item);
     // Set the container value to the content item.
     item->container = this;
+    // Update the weight of the content.
+    this->addContentWeight(itemWeight);
     // Update the database.
     if (updateDB && (this->getType() != ModelType::Corpse))
     {
@@ -523,6 +655,8 @@ bool Item::takeOut(Item * item, bool updateDB)
     }
     // Set the container reference of the item to nullptr.
     item->container = nullptr;
+    // Update the weight of the content.
+    this->addContentWeight(-item->getWeight(true));
     // Update the database.
     if (updateDB && (this->getType() != ModelType::Corpse))
     {
@@ -543,9 +677,10 @@ Item * Item::findContent(std::string search_parameter, int & number)
 {
     if (this->isAContainer())
     {
+        auto key = ToLower(search_parameter);
         for (auto iterator : content)
         {
-            if (iterator->hasKey(ToLower(search_parameter)))
+            if (iterator->hasKey(key))
             {
                 if (number == 1)
                 {
@@ -558,6 +693,11 @@ Item * Item::findContent(std::string search_parameter, int & number)
     return nullptr;
 }
 
+void Item::contentChanged()
+{
+    // Nothing to do.
+}
+
 void Item::setOccupiedBodyParts(
     std::vector<std::shared_ptr<BodyPart>> _occupiedBodyParts)
 {
@@ -0,0 +1,181 @@
+/// @file   itemQueryIndex.cpp
+/// @brief  Implements the indices used to search the items of the world.
+/// @author Enrico Fraccaroli
+/// @date   Oct 19 2026
+/// @copyright
+/// Copyright (c) 2016 Enrico Fraccaroli <enrico.fraccaroli@gmail.com>
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///     The above copyright notice and this permission notice shall be included
+///     in all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+
+
+#include "item/itemQueryIndex.hpp"
+
+#include "item/item.hpp"
+#include "utilities/utils.hpp"
+
+#include <algorithm>
+
+ItemQueryIndex::ItemQueryIndex() :
+    models(),
+    types(),
+    names(),
+    trigrams(),
+    entries()
+{
+    // Nothing to do.
+}
+
+void ItemQueryIndex::add(Item * item)
+{
+    if (entries.find(item) != entries.end())
+    {
+        return;
+    }
+    auto & model = models[item->model->vnum];
+    auto & type = types[ToLower(item->getTypeName())];
+    auto name = names.emplace(ToLower(item->getNames().name),
+                              ItemBucket()).first;
+    // Index the trigrams of a name only when its first item arrives.
+    if (name->second.empty())
+    {
+        for (size_t it = 0; it + 3 <= name->first.size(); ++it)
+        {
+            trigrams[name->first.substr(it, 3)].insert(&name->first);
+        }
+    }
+    model.emplace(item->vnum, item);
+    type.emplace(item->vnum, item);
+    name->second.emplace(item->vnum, item);
+    entries.emplace(item, Entry{&model, &type, name});
+}
+
+void ItemQueryIndex::remove(Item * item)
+{
+    auto entry = entries.find(item);
+    if (entry == entries.end())
+    {
+        return;
+    }
+    entry->second.model->erase(item->vnum);
+    entry->second.type->erase(item->vnum);
+    auto name = entry->second.name;
+    name->second.erase(item->vnum);
+    // Drop the name once its last item is gone.
+    if (name->second.empty())
+    {
+        for (size_t it = 0; it + 3 <= name->first.size(); ++it)
+        {
+            auto trigram = trigrams.find(name->first.substr(it, 3));
+            if (trigram != trigrams.end())
+            {
+                trigram->second.erase(&name->first);
+                if (trigram->second.empty())
+                {
+                    trigrams.erase(trigram);
+                }
+            }
+        }
+        names.erase(name);
+    }
+    entries.erase(entry);
+}
+
+std::vector<Item *> ItemQueryIndex::findByModel(int modelVnum) const
+{
+    auto it = models.find(modelVnum);
+    if (it == models.end())
+    {
+        return std::vector<Item *>();
+    }
+    return merge({&it->second});
+}
+
+std::vector<Item *> ItemQueryIndex::findByType(const std::string & prefix) const
+{
+    auto lower = ToLower(prefix);
+    std::vector<const ItemBucket *> buckets;
+    for (auto it = types.lower_bound(lower); it != types.end(); ++it)
+    {
+        if (it->first.compare(0, lower.size(), lower) != 0)
+        {
+            break;
+        }
+        buckets.emplace_back(&it->second);
+    }
+    return merge(buckets);
+}
+
+std::vector<Item *> ItemQueryIndex::findByName(const std::string & text) const
+{
+    auto lower = ToLower(text);
+    std::vector<const ItemBucket *> buckets;
+    if (lower.size() < 3)
+    {
+        // Too short to have trigrams, check every distinct name.
+        for (auto const & it : names)
+        {
+            if (it.first.find(lower) != std::string::npos)
+            {
+                buckets.emplace_back(&it.second);
+            }
+        }
+        return merge(buckets);
+    }
+    // Start from the trigram shared by the fewest names.
+    const std::set<const std::string *> * candidates = nullptr;
+    for (size_t it = 0; it + 3 <= lower.size(); ++it)
+    {
+        auto trigram = trigrams.find(lower.substr(it, 3));
+        if (trigram == trigrams.end())
+        {
+            return std::vector<Item *>();
+        }
+        if ((candidates == nullptr) ||
+            (trigram->second.size() < candidates->size()))
+        {
+            candidates = &trigram->second;
+        }
+    }
+    for (auto name : *candidates)
+    {
+        if (name->find(lower) != std::string::npos)
+        {
+            buckets.emplace_back(&names.at(*name));
+        }
+    }
+    return merge(buckets);
+}
+
+std::vector<Item *> ItemQueryIndex::merge(
+    const std::vector<const ItemBucket *> & buckets)
+{
+    std::vector<Item *> items;
+    for (auto bucket : buckets)
+    {
+        for (auto const & it : *bucket)
+        {
+            items.emplace_back(it.second);
+        }
+    }
+    if (buckets.size() > 1)
+    {
+        std::sort(items.begin(), items.end(), [](Item * a, Item * b)
+        {
+            return a->vnum < b->vnum;
+        });
+    }
+    return items;
+}
@@ -22,6 +22,9 @@
 #include "item/itemVector.hpp"
 #include "updater/updater.hpp"
 #include "item/item.hpp"
+#include "item/subitem/lightItem.hpp"
+
+#include <unordered_map>
 
 ItemVector::ItemVector()
 {
@@ -71,39 +74,72 @@ Item * ItemVector::findItem(const int & vnum) const
     return nullptr;
 }
 
-std::vector<std::pair<Item *, int>> ItemVector::toStack() const
+/// @brief The properties which determine if two items are shown together.
+struct StackKey
+{
+    /// The names shared by the items with the same model, material and
+    /// quality.
+    const ItemNames * names;
+    /// The built and lit state of the item.
+    unsigned int state;
+
+    bool operator==(const StackKey & other) const
+    {
+        return (names == other.names) && (state == other.state);
+    }
+};
+
+/// @brief Hash function of a StackKey.
+struct StackKeyHash
+{
+    size_t operator()(const StackKey & key) const
+    {
+        return std::hash<const void *>()(key.names) ^ (key.state << 1);
+    }
+};
+
+std::vector<ItemGroup> ItemVector::toStack() const
 {
-    std::vector<std::pair<Item *, int>> numberedItems;
+    std::vector<ItemGroup> groups;
+    // The position of each group inside the vector.
+    std::unordered_map<StackKey, size_t, StackKeyHash> positions;
+    positions.reserve(this->size());
     for (auto item : (*this))
     {
-        bool missing = true;
-        for (auto & it2 : numberedItems)
+        // The items which contain something are shown on their own.
+        if (!item->isEmpty())
+        {
+            groups.emplace_back(ItemGroup{item, 1, item->quantity,
+                                          item->getWeight(true)});
+            continue;
+        }
+        unsigned int state = 0;
+        if (HasFlag(item->flags, ItemFlag::Built))
+        {
+            state |= 1;
+        }
+        // The name of the light sources depends also on their state.
+        if ((item->getType() == ModelType::Light) &&
+            static_cast<LightItem *>(item)->isActive())
+        {
+            state |= 2;
+        }
+        auto position = positions.emplace(StackKey{&item->getNames(), state},
+                                          groups.size());
+        if (position.second)
         {
-            if (it2.first->getName() == item->getName())
-            {
-                if (HasFlag(it2.first->flags, ItemFlag::Built))
-                {
-                    if (HasFlag(item->flags, ItemFlag::Built))
-                    {
-                        missing = false;
-                        it2.second++;
-                        break;
-                    }
-                }
-                else
-                {
-                    missing = false;
-                    it2.second++;
-                    break;
-                }
-            }
+            groups.emplace_back(ItemGroup{item, 1, item->quantity,
+                                          item->getWeight(true)});
         }
-        if (missing)
+        else
         {
-            numberedItems.emplace_back(std::make_pair(item, 1));
+            auto & group = groups[position.first->second];
+            group.items += 1;
+            group.quantity += item->quantity;
+            group.weight += item->getWeight(true);
         }
     }
-    return numberedItems;
+    return groups;
 }
 
 void ItemVector::orderBy(const ItemVector::Order & order)
@@ -129,7 +165,7 @@ std::string ItemVector::orderToString(const Order & order)
 
 bool ItemVector::orderItemByName(Item * first, Item * second)
 {
-    return first->getName() < second->getName();
+    return first->getNames().name < second->getNames().name;
 }
 
 bool ItemVector::orderItemByWeight(Item * first, Item * second)
@@ -78,10 +78,10 @@ std::string ContainerItem::lookContent()
         return ss.str();
     }
     ss << "Looking inside you see:\n";
-    for (auto it : content)
+    for (auto const & it : content.toStack())
     {
-        ss << " [" << std::right << std::setw(3) << it->quantity << "] ";
-        ss << it->getNameCapital() << "\n";
+        ss << " [" << std::right << std::setw(3) << it.quantity << "] ";
+        ss << it.item->getNameCapital() << "\n";
     }
     ss << "Has been used " << Formatter::yellow(ToString(getUsedSpace()));
     ss << " out of " << Formatter::yellow(ToString(getTotalSpace())) << ' ';
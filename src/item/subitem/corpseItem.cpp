@@ -77,10 +77,10 @@ std::string CorpseItem::lookContent()
     }
     std::stringstream ss;
     ss << "Looking inside the corpse you see:\n";
-    for (auto it : content)
+    for (auto const & it : content.toStack())
     {
-        ss << " [" << std::right << std::setw(3) << it->quantity << "] ";
-        ss << it->getNameCapital() << "\n";
+        ss << " [" << std::right << std::setw(3) << it.quantity << "] ";
+        ss << it.item->getNameCapital() << "\n";
     }
     return ss.str();
 }
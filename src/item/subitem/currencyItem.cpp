@@ -66,7 +66,8 @@ double CurrencyItem::getWeight(bool) const
     return 0.0;
 }
 
-void CurrencyItem::triggerDecay()
+bool CurrencyItem::canDecay() const
 {
-    // Nothing to do.
+    // Currencies do not decay.
+    return false;
 }
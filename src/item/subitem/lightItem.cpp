@@ -115,6 +115,12 @@ double LightItem::getTotalSpace() const
     return ((spaceBase + (spaceBase * quality.getModifier())) / 2);
 }
 
+bool LightItem::needsTic() const
+{
+    // Only the active light sources consume their fuel.
+    return this->isActive();
+}
+
 bool LightItem::isActive() const
 {
     return active || HasFlag(model->toLight()->lightSourceFlags,
@@ -151,6 +151,8 @@ bool LiquidContainerItem::pourIn(Liquid * newLiquidContent,
         // Increment the liquid amount.
         liquidQuantity += quantityToPourIn;
     }
+    // Update the weight of the containers and of the owner.
+    this->invalidateWeight();
     // Prepare the query arguments.
     if (updateDB)
     {
@@ -183,6 +185,8 @@ LiquidContainerItem::pourOut(const double & quantityToPourOut, bool updateDB)
     {
         // Decrement the liquid amount.
         liquidQuantity -= quantityToPourOut;
+        // Update the weight of the containers and of the owner.
+        this->invalidateWeight();
         if (updateDB)
         {
             // Check if the quantity has dropped to zero.
@@ -32,7 +32,11 @@ ShopItem::ShopItem() :
     balance(),
     shopKeeper(),
     openingHour(6),
-    closingHour(18)
+    closingHour(18),
+    goods(),
+    goodsIndex(),
+    saleTable(),
+    catalogueValid()
 {
     // Nothing to do.
 }
@@ -141,45 +145,8 @@ std::string ShopItem::lookContent()
             ss << Formatter::italic("There is nothing on sale.\n\n");
             return ss.str();
         }
-        Table saleTable(shopName);
-        saleTable.addColumn("Good", align::left);
-        saleTable.addColumn("Quantity", align::center);
-        saleTable.addColumn("Weight (Single)", align::right);
-        saleTable.addColumn("Weight (stack)", align::right);
-        saleTable.addColumn("Buy", align::right);
-        saleTable.addColumn("Sell (Single)", align::right);
-        saleTable.addColumn("Sell (stack)", align::right);
-        for (auto iterator : content)
-        {
-            // Prepare the row.
-            TableRow row;
-            row.emplace_back(iterator->getNameCapital());
-            row.emplace_back(ToString(iterator->quantity));
-            row.emplace_back(ToString(iterator->getWeight(false)));
-            if (iterator->quantity > 1)
-            {
-                row.emplace_back(ToString(iterator->getWeight(true)));
-            }
-            else
-            {
-                row.emplace_back("");
-            }
-            row.emplace_back(ToString(this->evaluateBuyPrice(iterator)));
-            row.emplace_back(ToString(this->evaluateSellPrice(iterator)));
-            if (iterator->quantity > 1)
-            {
-                row.emplace_back(ToString(
-                    this->evaluateSellPrice(iterator) *
-                    iterator->quantity));
-            }
-            else
-            {
-                row.emplace_back("");
-            }
-            // Add the row to the table.
-            saleTable.addRow(row);
-        }
-        ss << saleTable.getTable();
+        this->updateCatalogue();
+        ss << saleTable;
     }
     ss << "Has been used " << Formatter::yellow(ToString(getUsedSpace()));
     ss << " out of " << Formatter::yellow(ToString(getTotalSpace())) << ' ';
@@ -251,10 +218,99 @@ bool ShopItem::canUse(std::string & error)
 
 unsigned int ShopItem::evaluateBuyPrice(Item * item)
 {
+    this->updateCatalogue();
+    auto good = goods.find(item);
+    if (good != goods.end())
+    {
+        return good->second.buyPrice;
+    }
     return shopBuyTax * item->getPrice(false);
 }
 
 unsigned int ShopItem::evaluateSellPrice(Item * item)
 {
+    this->updateCatalogue();
+    auto good = goods.find(item);
+    if (good != goods.end())
+    {
+        return good->second.sellPrice;
+    }
     return shopSellTax * item->getPrice(false);
 }
+
+Item * ShopItem::findGood(const std::string & key, int & number)
+{
+    if (!this->isAContainer())
+    {
+        return nullptr;
+    }
+    this->updateCatalogue();
+    for (auto item : goodsIndex.find(ToLower(key)))
+    {
+        if (number == 1)
+        {
+            return item;
+        }
+        --number;
+    }
+    return nullptr;
+}
+
+void ShopItem::contentChanged()
+{
+    catalogueValid = false;
+}
+
+void ShopItem::updateCatalogue()
+{
+    // Mark the catalogue as valid before building it, so that a change which
+    // happens in the meanwhile invalidates it again.
+    if (catalogueValid.exchange(true))
+    {
+        return;
+    }
+    goods.clear();
+    goodsIndex = KeywordIndex<Item>();
+    saleTable.clear();
+    Table table(shopName);
+    table.addColumn("Good", align::left);
+    table.addColumn("Quantity", align::center);
+    table.addColumn("Weight (Single)", align::right);
+    table.addColumn("Weight (stack)", align::right);
+    table.addColumn("Buy", align::right);
+    table.addColumn("Sell (Single)", align::right);
+    table.addColumn("Sell (stack)", align::right);
+    for (auto iterator : content)
+    {
+        auto price = iterator->getPrice(false);
+        ShopGood good{shopBuyTax * price, shopSellTax * price};
+        goods.emplace(iterator, good);
+        goodsIndex.add(iterator, iterator->getKeys());
+        // Prepare the row.
+        TableRow row;
+        row.emplace_back(iterator->getNameCapital());
+        row.emplace_back(ToString(iterator->quantity));
+        row.emplace_back(ToString(iterator->getWeight(false)));
+        if (iterator->quantity > 1)
+        {
+            row.emplace_back(ToString(iterator->getWeight(true)));
+        }
+        else
+        {
+            row.emplace_back("");
+        }
+        row.emplace_back(ToString(good.buyPrice));
+        row.emplace_back(ToString(good.sellPrice));
+        if (iterator->quantity > 1)
+        {
+            row.emplace_back(ToString(good.sellPrice * iterator->quantity));
+        }
+        else
+        {
+            row.emplace_back("");
+        }
+        // Add the row to the table.
+        table.addRow(row);
+    }
+    table.renderTable(saleTable);
+}
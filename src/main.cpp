@@ -23,9 +23,18 @@
 #include "mud.hpp"
 
 /// @brief  It's the main program.
+/// @details
+/// When started with "--arena", followed by the arguments of the arena, it
+///  runs the combat arena on the loaded world and exits, without accepting
+///  any connection.
 /// @return Error code.
-int main()
+int main(int argc, char ** argv)
 {
+    if ((argc > 1) && (std::string(argv[1]) == "--arena"))
+    {
+        std::vector<std::string> args(argv + 2, argv + argc);
+        return Mud::instance().runArena(args) ? 0 : 1;
+    }
     if (Mud::instance().runMud())
     {
         return 0;
@@ -61,7 +61,10 @@ ItemModel::ItemModel() :
     condition(),
     material(),
     tileSet(),
-    tileId()
+    tileId(),
+    names(),
+    namesVersion(),
+    namesMutex()
 {
     // Nothing to do.
 }
@@ -241,28 +244,56 @@ bool ItemModel::replaceSymbols(
     Material * itemMaterial,
     const ItemQuality & itemQuality) const
 {
-    bool modified = false;
-    if (itemMaterial)
+    bool modified = (itemMaterial != nullptr) ||
+                    (itemQuality != ItemQuality::Normal);
+    auto position = source.find('&');
+    if (position == std::string::npos)
     {
-        modified = true;
-        FindAndReplace(&source, "&m", ToLower(itemMaterial->name));
-        FindAndReplace(&source, "&M", ToLower(
-            itemMaterial->article + ' ' + itemMaterial->name));
+        return modified;
     }
-    else
-    {
-        FindAndReplace(&source, "&m", "");
-        FindAndReplace(&source, "&M", "");
-    }
-    if (itemQuality != ItemQuality::Normal)
+    // Replace all the symbols in a single pass.
+    std::string result;
+    result.reserve(source.size() + 32);
+    std::string::size_type start = 0;
+    while (position != std::string::npos)
     {
-        modified = true;
-        FindAndReplace(&source, "&q", " " + ToLower(itemQuality.toString()));
-    }
-    else
-    {
-        FindAndReplace(&source, "&q", "");
+        result.append(source, start, position - start);
+        start = position + 2;
+        auto symbol = (start <= source.size()) ? source[position + 1] : '\0';
+        if (symbol == 'm')
+        {
+            if (itemMaterial)
+            {
+                AppendLower(result, itemMaterial->name);
+            }
+        }
+        else if (symbol == 'M')
+        {
+            if (itemMaterial)
+            {
+                AppendLower(result, itemMaterial->article);
+                result.push_back(' ');
+                AppendLower(result, itemMaterial->name);
+            }
+        }
+        else if (symbol == 'q')
+        {
+            if (itemQuality != ItemQuality::Normal)
+            {
+                result.push_back(' ');
+                AppendLower(result, itemQuality.toString());
+            }
+        }
+        else
+        {
+            // It is not a symbol, keep the ampersand.
+            result.push_back('&');
+            start = position + 1;
+        }
+        position = source.find('&', start);
     }
+    result.append(source, start, std::string::npos);
+    source.swap(result);
     return modified;
 }
 
@@ -279,6 +310,44 @@ std::string ItemModel::getName(Material * itemMaterial,
     return output;
 }
 
+std::shared_ptr<const ItemNames> ItemModel::getNames(
+    Material * itemMaterial,
+    const ItemQuality & itemQuality) const
+{
+    std::lock_guard<std::mutex> lock(namesMutex);
+    auto key = std::make_pair(itemMaterial, itemQuality.toUInt());
+    auto it = names.find(key);
+    if (it != names.end())
+    {
+        return it->second;
+    }
+    auto itemNames = std::make_shared<ItemNames>();
+    itemNames->composition = itemMaterial;
+    itemNames->quality = itemQuality;
+    itemNames->version = namesVersion;
+    itemNames->name = this->getName(itemMaterial, itemQuality);
+    itemNames->nameCapital = itemNames->name;
+    if (!itemNames->nameCapital.empty())
+    {
+        itemNames->nameCapital[0] = static_cast<char>(
+            toupper(itemNames->nameCapital[0]));
+    }
+    itemNames->keys = keys;
+    for (auto & itemKey : itemNames->keys)
+    {
+        this->replaceSymbols(itemKey, itemMaterial, itemQuality);
+    }
+    names.emplace(key, itemNames);
+    return itemNames;
+}
+
+void ItemModel::invalidateNames()
+{
+    std::lock_guard<std::mutex> lock(namesMutex);
+    names.clear();
+    ++namesVersion;
+}
+
 std::string ItemModel::getDescription(Material * itemMaterial,
                                       const ItemQuality & itemQuality)
 {
@@ -28,7 +28,9 @@
 #include "input/initialization/processPlayerName.hpp"
 #include "utilities/CMacroWrapper.hpp"
 #include "utilities/stopwatch.hpp"
+#include "updater/tickProfiler.hpp"
 #include "utilities/logger.hpp"
+#include "action/combat/combatArena.hpp"
 
 /// Input file descriptor.
 static fd_set in_set;
@@ -59,6 +61,7 @@ Mud::Mud() :
     mudPlayers(),
     mudMobiles(),
     mudItems(),
+    mudItemIndex(),
     mudRooms(),
     mudItemModels(),
     mudAreas(),
@@ -240,6 +243,8 @@ bool Mud::addItem(Item * item)
     if (mudItems.insert(std::make_pair(item->vnum, item)).second)
     {
         _maxVnumItem = std::max(_maxVnumItem, item->vnum);
+        mudItemIndex.add(item);
+        MudUpdater::instance().registerItem(item);
         return true;
     }
     return false;
@@ -247,15 +252,15 @@ bool Mud::addItem(Item * item)
 
 bool Mud::remItem(Item * item)
 {
-    for (auto it = mudItems.begin(); it != mudItems.end(); ++it)
+    auto it = mudItems.find(item->vnum);
+    if (it == mudItems.end())
     {
-        if (it->second->vnum == item->vnum)
-        {
-            mudItems.erase(it);
-            return true;
-        }
+        return false;
     }
-    return false;
+    mudItems.erase(it);
+    mudItemIndex.remove(item);
+    MudUpdater::instance().unregisterItem(item);
+    return true;
 }
 
 bool Mud::addRoom(Room * room)
@@ -286,6 +291,7 @@ bool Mud::addCorpse(Item * corpse)
     if (mudCorpses.insert(std::make_pair(corpse->vnum, corpse)).second)
     {
         _minVnumCorpses = std::min(_minVnumCorpses, corpse->vnum);
+        MudUpdater::instance().registerItem(corpse);
         return true;
     }
     return false;
@@ -293,15 +299,14 @@ bool Mud::addCorpse(Item * corpse)
 
 bool Mud::remCorpse(Item * corpse)
 {
-    for (auto it = mudCorpses.begin(); it != mudCorpses.end(); ++it)
+    auto it = mudCorpses.find(corpse->vnum);
+    if (it == mudCorpses.end())
     {
-        if (it->second->vnum == corpse->vnum)
-        {
-            mudCorpses.erase(it);
-            return true;
-        }
+        return false;
     }
-    return false;
+    mudCorpses.erase(it);
+    MudUpdater::instance().unregisterItem(corpse);
+    return true;
 }
 
 bool Mud::addItemModel(std::shared_ptr<ItemModel> model)
@@ -402,13 +407,18 @@ bool Mud::addGeneratedMap(const std::shared_ptr<MapWrapper> & mapWrapper)
     return true;
 }
 
+bool Mud::addMapJob(const std::shared_ptr<MapGenerationJob> & mapJob)
+{
+    return mudMapJobs.insert(std::make_pair(mapJob->id, mapJob)).second;
+}
+
 Player * Mud::findPlayer(const std::string & name)
 {
     for (auto it : mudPlayers)
     {
         // If the player is not playing, continue.
         if (!it->isPlaying()) continue;
-        if (ToLower(it->getName()) == ToLower(name)) return it;
+        if (EqualNoCase(it->name, name)) return it;
     }
     return nullptr;
 }
@@ -459,7 +469,7 @@ Race * Mud::findRace(std::string name)
 {
     for (auto & it : mudRaces)
     {
-        if (ToLower(it.second->name) == ToLower(name)) return it.second;
+        if (EqualNoCase(it.second->name, name)) return it.second;
     }
     return nullptr;
 }
@@ -474,7 +484,7 @@ Faction * Mud::findFaction(std::string name)
 {
     for (auto & it : mudFactions)
     {
-        if (ToLower(it.second->name) == ToLower(name)) return it.second;
+        if (EqualNoCase(it.second->name, name)) return it.second;
     }
     return nullptr;
 }
@@ -531,7 +541,7 @@ Production * Mud::findProduction(std::string name)
 {
     for (auto & it : mudProductions)
     {
-        if (ToLower(it.second->name) == ToLower(name)) return it.second;
+        if (EqualNoCase(it.second->name, name)) return it.second;
     }
     return nullptr;
 }
@@ -552,7 +562,7 @@ std::shared_ptr<Building> Mud::findBuilding(std::string name)
 {
     for (auto & it : mudBuildings)
     {
-        if (ToLower(it.second->name) == ToLower(name)) return it.second;
+        if (EqualNoCase(it.second->name, name)) return it.second;
     }
     return nullptr;
 }
@@ -606,10 +616,14 @@ bool Mud::runMud()
     // We will go through this loop roughly every timeout seconds.
     do
     {
+        TickProfiler::instance().beginTick();
         // Let the time advance.
         MudUpdater::instance().advanceTime();
         // Delete the inactive players.
-        this->removeInactivePlayers();
+        {
+            ProfilePhase profile(TickPhase::InactivePlayers);
+            this->removeInactivePlayers();
+        }
         // Get ready for "select" function.
         FD_ZERO(&in_set);
         FD_ZERO(&out_set);
@@ -624,15 +638,19 @@ bool Mud::runMud()
             this->setupDescriptor(iterator);
         }
         // Check for activity, timeout after 'timeout' seconds.
-        int activity = select((_maxDesc + 1), &in_set, &out_set, &exc_set,
-                              &timeoutVal);
-        if ((activity < 0) && (errno != EINTR))
         {
-            perror("Select");
+            ProfilePhase profile(TickPhase::Select);
+            int activity = select((_maxDesc + 1), &in_set, &out_set, &exc_set,
+                                  &timeoutVal);
+            if ((activity < 0) && (errno != EINTR))
+            {
+                perror("Select");
+            }
         }
         // Check if there are new connections on control port.
         if (CMacroWrapper::FdIsSet(_servSocket, &in_set))
         {
+            ProfilePhase profile(TickPhase::Accept);
             if (!this->processNewConnection())
             {
                 Logger::log(LogLevel::Error,
@@ -644,6 +662,7 @@ bool Mud::runMud()
         {
             this->processDescriptor(iterator);
         }
+        TickProfiler::instance().endTick();
     } while (!_shutdownSignal);
     if (!this->stopMud())
     {
@@ -654,6 +673,41 @@ bool Mud::runMud()
     return true;
 }
 
+bool Mud::runArena(const std::vector<std::string> & args)
+{
+    // Open logging file.
+    if (!Logger::instance().openLog(
+        Mud::instance().getMudSystemDirectory() + GetDate() + ".log"))
+    {
+        std::cerr << "Can't create the logging file." << std::endl;
+        return false;
+    }
+    Logger::log(LogLevel::Global, "Initializing Database...");
+    if (!this->initDatabase())
+    {
+        Logger::log(LogLevel::Error,
+                    "Something gone wrong during database initialization.");
+        return false;
+    }
+    std::string report, error;
+    auto result = RunCombatArena(args, report, error);
+    if (result)
+    {
+        std::cout << report;
+    }
+    else
+    {
+        std::cerr << error << std::endl;
+    }
+    // The world is discarded without being saved.
+    if (!SQLiteDbms::instance().closeDatabase())
+    {
+        Logger::log(LogLevel::Error,
+                    "The database has not been closed correctly.");
+    }
+    return result;
+}
+
 void Mud::shutDownSignal()
 {
     // Game over - Tell them all.
@@ -712,8 +766,21 @@ int Mud::getUniqueAreaVnum() const
     return vnum;
 }
 
+unsigned int Mud::getUniqueGeneratedMapVnum() const
+{
+    unsigned int vnum = 1;
+    while ((mudGeneratedMaps.find(vnum) != mudGeneratedMaps.end()) ||
+           (mudMapJobs.find(vnum) != mudMapJobs.end()))
+    {
+        ++vnum;
+    }
+    return vnum;
+}
+
 void Mud::broadcastMsg(const int & level, const std::string & message) const
 {
+    // Format the message once and share it among the recipients.
+    SharedMessage shared;
     for (auto iterator : mudPlayers)
     {
         // If the player is not playing, continue.
@@ -721,13 +788,15 @@ void Mud::broadcastMsg(const int & level, const std::string & message) const
         {
             continue;
         }
-        if (level == 1 && HasFlag(iterator->flags, CharacterFlag::IsGod))
-        {
-            iterator->sendMsg("\n" + message + "\n");
-        }
-        else if (level == 0)
+        if ((level == 1 && HasFlag(iterator->flags, CharacterFlag::IsGod)) ||
+            (level == 0))
         {
-            iterator->sendMsg("\n" + message + "\n");
+            if (!shared)
+            {
+                shared = std::make_shared<const std::string>(
+                    "\n" + message + "\n");
+            }
+            iterator->sendMsg(shared);
         }
     }
 }
@@ -907,6 +976,7 @@ void Mud::processDescriptor(Player * player)
     {
         if (CMacroWrapper::FdIsSet(player->getSocket(), &in_set))
         {
+            ProfilePhase profile(TickPhase::Read);
             player->processRead();
         }
     }
@@ -915,6 +985,7 @@ void Mud::processDescriptor(Player * player)
     {
         if (CMacroWrapper::FdIsSet(player->getSocket(), &out_set))
         {
+            ProfilePhase profile(TickPhase::Write);
             player->processWrite();
         }
     }
@@ -1115,6 +1186,18 @@ bool Mud::stopMud()
                     "The communication has not been closed correctly.");
     }
 
+    Logger::log(LogLevel::Global, "Stopping Map Generation...");
+    // Cancel the running jobs, their destructor waits for the threads.
+    Mud::instance().mudMapJobs.clear();
+    // Complete the maps which are still being built.
+    for (auto it : Mud::instance().mudGeneratedMaps)
+    {
+        if (it.second->isBuilding())
+        {
+            it.second->buildStep(it.second->map.size() * 2);
+        }
+    }
+
     Logger::log(LogLevel::Global, "Saving Mud Information...");
     if (!Mud::instance().saveMud())
     {
@@ -573,6 +573,33 @@ std::vector<Coordinates> Area::fov(Coordinates & origin, const int & radius)
     return cfov;
 }
 
+void Area::updateSightAround(Room * room)
+{
+    // Whoever can see through the room now, was looking at it or at one of
+    // the surrounding rooms.
+    std::vector<Character *> observers;
+    for (int x = room->coord.x - 1; x <= room->coord.x + 1; ++x)
+    {
+        for (int y = room->coord.y - 1; y <= room->coord.y + 1; ++y)
+        {
+            auto neighbour = this->getRoom(Coordinates(x, y, room->coord.z));
+            if (neighbour == nullptr) continue;
+            for (auto observer : neighbour->getObservers())
+            {
+                if (std::find(observers.begin(), observers.end(), observer) ==
+                    observers.end())
+                {
+                    observers.emplace_back(observer);
+                }
+            }
+        }
+    }
+    for (auto observer : observers)
+    {
+        observer->areaOfInterest.update();
+    }
+}
+
 bool Area::los(const Coordinates & source,
                const Coordinates & target,
                const int & radius)
@@ -0,0 +1,102 @@
+/// @file   mapGenerationJob.cpp
+/// @author Enrico Fraccaroli
+/// @date   Oct 19 2026
+/// @copyright
+/// Copyright (c) 2017 Enrico Fraccaroli <enrico.fraccaroli@gmail.com>
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///     The above copyright notice and this permission notice shall be included
+///     in all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+
+
+#include "structure/map_generation/mapGenerationJob.hpp"
+#include "utilities/logger.hpp"
+
+MapGenerationJob::MapGenerationJob(
+    const unsigned int & _id,
+    const std::string & _owner,
+    const MapGeneratorConfiguration & _configuration,
+    const std::shared_ptr<HeightMap> & _heightMap) :
+    id(_id),
+    owner(_owner),
+    generator(_configuration, _heightMap),
+    map(std::make_shared<MapWrapper>()),
+    status(MapGenerationStatus::Running),
+    worker()
+{
+    map->vnum = id;
+}
+
+MapGenerationJob::~MapGenerationJob()
+{
+    this->cancel();
+    if (worker.joinable())
+    {
+        worker.join();
+    }
+}
+
+void MapGenerationJob::start()
+{
+    if (worker.joinable())
+    {
+        Logger::log(LogLevel::Error, "The job %s is already started.", id);
+        return;
+    }
+    worker = std::thread([this]()
+    {
+        if (generator.generateMap(map))
+        {
+            status = MapGenerationStatus::Completed;
+        }
+        else if (generator.isCancelled())
+        {
+            status = MapGenerationStatus::Cancelled;
+        }
+        else
+        {
+            status = MapGenerationStatus::Failed;
+        }
+    });
+}
+
+void MapGenerationJob::cancel()
+{
+    generator.cancel();
+}
+
+std::shared_ptr<MapWrapper> MapGenerationJob::getMap() const
+{
+    if (status != MapGenerationStatus::Completed)
+    {
+        return nullptr;
+    }
+    return map;
+}
+
+std::string MapGenerationJob::getStatusString() const
+{
+    switch (this->getStatus())
+    {
+        case MapGenerationStatus::Running:
+            return "Running";
+        case MapGenerationStatus::Completed:
+            return "Completed";
+        case MapGenerationStatus::Failed:
+            return "Failed";
+        case MapGenerationStatus::Cancelled:
+            return "Cancelled";
+    }
+    return "Unknown";
+}
@@ -19,191 +19,227 @@
 /// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
 /// DEALINGS IN THE SOFTWARE.
 
+
 #include "structure/map_generation/mapGenerator.hpp"
+#include "structure/map_generation/spatialHash.hpp"
 #include "utilities/logger.hpp"
 #include "structure/area.hpp"
 #include "structure/structureUtils.hpp"
 
+#include <atomic>
+#include <climits>
+#include <mutex>
+#include <thread>
+
 MapGenerator::MapGenerator(const MapGeneratorConfiguration & _configuration,
                            const std::shared_ptr<HeightMap> & _heightMap) :
     configuration(_configuration),
-    heightMap(_heightMap)
-{
-    // Nothing to do.
-}
-
-bool MapGenerator::generateMap(const std::shared_ptr<MapWrapper> & map)
+    heightMap(_heightMap),
+    generator(),
+    numThreads(_configuration.numThreads),
+    completedStages(),
+    cancelled()
 {
-    // Initialize the map.
-    if (!this->initializeMap(map))
-    {
-        Logger::log(LogLevel::Error, "While initializing the map.");
-        return false;
-    }
-    // Generate the mountains.
-    if (!this->generateMountains(map))
-    {
-        Logger::log(LogLevel::Error, "While generating the mountains.");
-        return false;
-    }
-    // Normalize the map in order to have values between 0 and 100.
-    if (!this->normalizeMap(map))
-    {
-        Logger::log(LogLevel::Error, "While normalizing the map.");
-        return false;
-    }
-    // Apply the heights to the map.
-    if (!this->applyTerrain(map))
-    {
-        Logger::log(LogLevel::Error, "While applying the terrains to the map.");
-        return false;
-    }
-    // Generate the rivers.
-    if (!this->generateRivers(map))
+    // Pick a random seed if none has been provided, and store it inside the
+    // configuration so that the same map can be generated again.
+    if (configuration.seed == 0)
     {
-        Logger::log(LogLevel::Error, "While generating the rivers.");
-        return false;
+        configuration.seed = TRand<unsigned int>(1, UINT_MAX);
     }
-    // Generate the forests.
-    if (!this->generateForests(map))
+    generator.seed(configuration.seed);
+    Random::record("map", configuration.seed);
+    if (numThreads == 0)
     {
-        Logger::log(LogLevel::Error, "While generating the forests.");
-        return false;
+        numThreads = std::max(std::thread::hardware_concurrency(), 1u);
     }
-    // Reset the z coordinates.
-    if (!this->resetZCoordinates(map))
+}
+
+bool MapGenerator::generateMap(const std::shared_ptr<MapWrapper> & map)
+{
+    completedStages = 0;
+    // The stages of the generation, with the message logged on failure.
+    const std::vector<std::pair<bool (MapGenerator::*)(
+        const std::shared_ptr<MapWrapper> &), std::string>> stages = {
+        // Initialize the map.
+        {&MapGenerator::initializeMap, "While initializing the map."},
+        // Generate the mountains.
+        {&MapGenerator::generateMountains, "While generating the mountains."},
+        // Normalize the map in order to have values between 0 and 100.
+        {&MapGenerator::normalizeMap, "While normalizing the map."},
+        // Apply the heights to the map.
+        {&MapGenerator::applyTerrain,
+            "While applying the terrains to the map."},
+        // Generate the rivers.
+        {&MapGenerator::generateRivers, "While generating the rivers."},
+        // Generate the forests.
+        {&MapGenerator::generateForests, "While generating the forests."},
+        // Reset the z coordinates.
+        {&MapGenerator::resetZCoordinates,
+            "While setting the z coordinates."}
+    };
+    for (auto const & stage : stages)
     {
-        Logger::log(LogLevel::Error, "While setting the z coordinates.");
-        return false;
+        if (cancelled)
+        {
+            Logger::log(LogLevel::Info, "The map generation was cancelled.");
+            return false;
+        }
+        if (!(this->*stage.first)(map))
+        {
+            Logger::log(LogLevel::Error, stage.second);
+            return false;
+        }
+        ++completedStages;
     }
     return true;
 }
 
+unsigned int MapGenerator::getProgress() const
+{
+    return (completedStages * 100) / MapGenerator::numStages;
+}
+
+void MapGenerator::cancel()
+{
+    cancelled = true;
+}
+
 bool MapGenerator::initializeMap(const std::shared_ptr<MapWrapper> & map)
 {
     // Set the dimension of the map.
-    map->setWidth(configuration.width);
-    map->setHeight(configuration.height);
-    // Set the coordinates.
-    for (int x = 0; x < map->getWidth(); ++x)
-    {
-        for (int y = 0; y < map->getHeight(); ++y)
-        {
-            // Get the cell.
-            auto cell = map->getCell(x, y);
-            // Set the coordinates.
-            cell->coordinates = Coordinates(x, y, 0);
-        }
-    }
-    // Connects the cells.
-    for (int x = 0; x < map->getWidth(); ++x)
+    map->setDimensions(configuration.width, configuration.height);
+    // Set the coordinates and connect the cells. Each cell only modifies
+    // itself, so the bands can be processed in parallel.
+    std::atomic<bool> success(true);
+    this->parallelBands(map->getWidth(), [&](int xBegin, int xEnd)
     {
-        for (int y = 0; y < map->getHeight(); ++y)
+        for (int x = xBegin; x < xEnd; ++x)
         {
-            // Get the cell.
-            auto cell = map->getCell(x, y);
-            if (x - 1 >= 0)
+            for (int y = 0; y < map->getHeight(); ++y)
             {
-                auto neighbour = map->getCell(x - 1, y);
-                if (neighbour == nullptr)
+                // Get the cell.
+                auto cell = map->getCell(x, y);
+                // Set the coordinates.
+                cell->coordinates = Coordinates(x, y, 0);
+                // Connect the cell with its neighbours.
+                if ((x - 1 >= 0) &&
+                    !cell->addNeighbour(Direction::West,
+                                        map->getCell(x - 1, y)))
                 {
-                    Logger::log(LogLevel::Error, "Found nullptr neighbour");
-                    return false;
+                    success = false;
                 }
-                cell->addNeighbour(Direction::West, neighbour);
-            }
-            if (x + 1 < map->getWidth())
-            {
-                auto neighbour = map->getCell(x + 1, y);
-                if (neighbour == nullptr)
+                if ((x + 1 < map->getWidth()) &&
+                    !cell->addNeighbour(Direction::East,
+                                        map->getCell(x + 1, y)))
                 {
-                    Logger::log(LogLevel::Error, "Found nullptr neighbour");
-                    return false;
+                    success = false;
                 }
-                cell->addNeighbour(Direction::East, neighbour);
-            }
-            if (y - 1 >= 0)
-            {
-                auto neighbour = map->getCell(x, y - 1);
-                if (neighbour == nullptr)
+                if ((y - 1 >= 0) &&
+                    !cell->addNeighbour(Direction::South,
+                                        map->getCell(x, y - 1)))
                 {
-                    Logger::log(LogLevel::Error, "Found nullptr neighbour");
-                    return false;
+                    success = false;
                 }
-                cell->addNeighbour(Direction::South, neighbour);
-            }
-            if (y + 1 < map->getHeight())
-            {
-                auto neighbour = map->getCell(x, y + 1);
-                if (neighbour == nullptr)
+                if ((y + 1 < map->getHeight()) &&
+                    !cell->addNeighbour(Direction::North,
+                                        map->getCell(x, y + 1)))
                 {
-                    Logger::log(LogLevel::Error, "Found nullptr neighbour");
-                    return false;
+                    success = false;
                 }
-                cell->addNeighbour(Direction::North, neighbour);
             }
         }
+    });
+    if (!success)
+    {
+        Logger::log(LogLevel::Error, "Found nullptr neighbour");
+        return false;
     }
     return true;
 }
 
 bool MapGenerator::generateMountains(const std::shared_ptr<MapWrapper> & map)
 {
+    /// The position and size of a mountain.
+    struct Mountain
+    {
+        int xCenter;
+        int yCenter;
+        int radius;
+    };
+    // Draw the mountains serially, so that the random sequence does not
+    // depend on the number of threads.
+    std::vector<Mountain> mountains;
+    mountains.reserve(static_cast<size_t>(
+                          std::max(configuration.numMountains, 0)));
     for (int i = 0; i < configuration.numMountains; ++i)
     {
         // Generate a random dimension for the mountain.
-        auto radius = TRand<int>(configuration.minMountainRadius,
-                                 configuration.maxMountainRadius);
+        auto radius = this->randomInt(configuration.minMountainRadius,
+                                      configuration.maxMountainRadius);
         // Generate a random place for the mountain.
-        auto xCenter = TRand<int>(-radius, map->getWidth() + radius);
-        auto yCenter = TRand<int>(-radius, map->getHeight() + radius);
-        // Determine the boundaries.
-        auto xMin = std::max(xCenter - radius - 1, 0);
-        auto xMax = std::min(xCenter + radius + 1, map->getWidth() - 1);
-        auto yMin = std::max(yCenter - radius - 1, 0);
-        auto yMax = std::min(yCenter + radius + 1, map->getHeight() - 1);
-        // Evaluate the square of the radius.
-        auto squareRadius = radius * radius;
-        // Evaluate the height of each cell inside the boundaries.
-        for (auto x = xMin; x <= xMax; ++x)
+        auto xCenter = this->randomInt(-radius, map->getWidth() + radius);
+        auto yCenter = this->randomInt(-radius, map->getHeight() + radius);
+        mountains.emplace_back(Mountain{xCenter, yCenter, radius});
+    }
+    // Stamp the mountains, each band only sums the heights of its own cells.
+    this->parallelBands(map->getWidth(), [&](int xBegin, int xEnd)
+    {
+        for (auto const & mountain : mountains)
         {
-            for (auto y = yMin; y <= yMax; ++y)
+            // Determine the boundaries.
+            auto xMin = std::max(mountain.xCenter - mountain.radius - 1,
+                                 xBegin);
+            auto xMax = std::min(mountain.xCenter + mountain.radius + 1,
+                                 xEnd - 1);
+            auto yMin = std::max(mountain.yCenter - mountain.radius - 1, 0);
+            auto yMax = std::min(mountain.yCenter + mountain.radius + 1,
+                                 map->getHeight() - 1);
+            // Evaluate the square of the radius.
+            auto squareRadius = mountain.radius * mountain.radius;
+            // Evaluate the height of each cell inside the boundaries.
+            for (auto x = xMin; x <= xMax; ++x)
             {
-                // Determine the distance between the cell and the center.
-                auto distance = pow(xCenter - x, 2) + pow(yCenter - y, 2);
-                // Determine the height of the cell based on the distance.
-                auto cellHeight = squareRadius - distance;
-                // Set the height value on the map.
-                if (cellHeight > 0)
+                for (auto y = yMin; y <= yMax; ++y)
                 {
-                    map->getCell(x, y)->coordinates.z +=
-                        static_cast<int>(std::ceil(cellHeight));
+                    // Determine the distance between the cell and the center.
+                    auto distance =
+                        (mountain.xCenter - x) * (mountain.xCenter - x) +
+                        (mountain.yCenter - y) * (mountain.yCenter - y);
+                    // Determine the height of the cell based on the distance.
+                    auto cellHeight = squareRadius - distance;
+                    // Set the height value on the map.
+                    if (cellHeight > 0)
+                    {
+                        map->getCell(x, y)->coordinates.z += cellHeight;
+                    }
                 }
             }
         }
-    }
+    });
     return true;
 }
 
 bool MapGenerator::normalizeMap(const std::shared_ptr<MapWrapper> & map)
 {
+    // Find the minimum and maximum heights of each band.
+    std::mutex boundsMutex;
     auto minHeight = 0, maxHeight = 0;
-    // Find the minimum and maximum heights.
-    for (auto x = 0; x < map->getWidth(); ++x)
+    this->parallelBands(map->getWidth(), [&](int xBegin, int xEnd)
     {
-        for (auto y = 0; y < map->getHeight(); ++y)
+        auto bandMin = 0, bandMax = 0;
+        for (auto x = xBegin; x < xEnd; ++x)
         {
-            auto cell = map->getCell(x, y);
-            if (cell->coordinates.z < minHeight)
+            for (auto y = 0; y < map->getHeight(); ++y)
             {
-                minHeight = cell->coordinates.z;
-            }
-            if (cell->coordinates.z > maxHeight)
-            {
-                maxHeight = cell->coordinates.z;
+                auto cell = map->getCell(x, y);
+                bandMin = std::min(bandMin, cell->coordinates.z);
+                bandMax = std::max(bandMax, cell->coordinates.z);
             }
         }
-    }
+        std::lock_guard<std::mutex> lock(boundsMutex);
+        minHeight = std::min(minHeight, bandMin);
+        maxHeight = std::max(maxHeight, bandMax);
+    });
     // Drop the map if it is quite plain.
     if (DoubleEquality(maxHeight, minHeight))
     {
@@ -212,19 +248,22 @@ bool MapGenerator::normalizeMap(const std::shared_ptr<MapWrapper> & map)
         map->destroy();
         return false;
     }
-    // Normalize the heights to values between 0 and 10.
-    for (int x = 0; x < map->getWidth(); ++x)
+    // Normalize the heights to values between 0 and 100.
+    this->parallelBands(map->getWidth(), [&](int xBegin, int xEnd)
     {
-        for (int y = 0; y < map->getHeight(); ++y)
+        for (int x = xBegin; x < xEnd; ++x)
         {
-            auto cell = map->getCell(x, y);
-            cell->coordinates.z = Normalize(cell->coordinates.z,
-                                            minHeight,
-                                            maxHeight,
-                                            0,
-                                            100);
+            for (int y = 0; y < map->getHeight(); ++y)
+            {
+                auto cell = map->getCell(x, y);
+                cell->coordinates.z = Normalize(cell->coordinates.z,
+                                                minHeight,
+                                                maxHeight,
+                                                0,
+                                                100);
+            }
         }
-    }
+    });
     return true;
 }
 
@@ -235,22 +274,31 @@ bool MapGenerator::applyTerrain(const std::shared_ptr<MapWrapper> & map)
         Logger::log(LogLevel::Error, "HeightMap not set.");
         return false;
     }
-    for (auto x = 0; x < map->getWidth(); ++x)
+    std::atomic<bool> success(true);
+    this->parallelBands(map->getWidth(), [&](int xBegin, int xEnd)
     {
-        for (auto y = 0; y < map->getHeight(); ++y)
+        for (auto x = xBegin; x < xEnd; ++x)
         {
-            // Get the cell.
-            auto cell = map->getCell(x, y);
-            // Get the terrain associated with the cell height.
-            auto terrain = heightMap->getTerrain(cell->coordinates.z);
-            if (terrain == nullptr)
+            for (auto y = 0; y < map->getHeight(); ++y)
             {
-                Logger::log(LogLevel::Error, "Applying a terrain.");
-                return false;
+                // Get the cell.
+                auto cell = map->getCell(x, y);
+                // Get the terrain associated with the cell height.
+                auto terrain = heightMap->getTerrain(cell->coordinates.z);
+                if (terrain == nullptr)
+                {
+                    success = false;
+                    return;
+                }
+                cell->terrain = terrain;
+                cell->liquidContent = terrain->liquidContent;
             }
-            cell->terrain = terrain;
-            cell->liquidContent = terrain->liquidContent;
         }
+    });
+    if (!success)
+    {
+        Logger::log(LogLevel::Error, "Applying a terrain.");
+        return false;
     }
     return true;
 }
@@ -258,36 +306,26 @@ bool MapGenerator::applyTerrain(const std::shared_ptr<MapWrapper> & map)
 bool MapGenerator::generateRivers(const std::shared_ptr<MapWrapper> & map)
 {
     // List of possible starting points for a river.
-    std::list<MapCell *> startingPoints;
-    // Lamba used to check if a cell is far away from pre-existing starting
-    // points and if it is a mountain.
-    auto IsSuitable = [&](MapCell * cell)
-    {
-        if (cell->terrain->liquidSources.empty())
-        {
-            return false;
-        }
-        for (auto point : startingPoints)
-        {
-            auto distance = StructUtils::getDistance(cell->coordinates,
-                                                          point->coordinates);
-            if (distance <= configuration.minRiverDistance)
-            {
-                return false;
-            }
-        }
-        return true;
-    };
+    std::vector<MapCell *> startingPoints;
+    // The starting points hashed by position, used to check the distance of
+    // a cell only against the nearby starting points.
+    SpatialHash startingPointsHash(configuration.minRiverDistance);
     // Retrieve all the starting points for rivers.
     for (auto x = 0; x < map->getWidth(); ++x)
     {
         for (auto y = 0; y < map->getHeight(); ++y)
         {
             auto cell = map->getCell(x, y);
-            // Check if it is a suitable cell.
-            if (IsSuitable(cell))
+            // Check if the cell is far away from pre-existing starting
+            // points and if it is a mountain.
+            if (cell->terrain->liquidSources.empty())
+            {
+                continue;
+            }
+            if (startingPointsHash.isFarEnough(cell))
             {
                 startingPoints.emplace_back(cell);
+                startingPointsHash.add(cell);
             }
         }
     }
@@ -299,10 +337,9 @@ bool MapGenerator::generateRivers(const std::shared_ptr<MapWrapper> & map)
         // Prepare a vector for the river.
         std::vector<MapCell *> river;
         // Set the starting cell.
-        MapCell * cell = startingPoints.front();
-        startingPoints.pop_front();
+        MapCell * cell = startingPoints[it];
         // Pick from the available liquids of the starting cell.
-        auto liquid = cell->terrain->getRandomLiquidSource();
+        auto liquid = cell->terrain->getRandomLiquidSource(generator);
         if (liquid == nullptr)
         {
             Logger::log(LogLevel::Error, "No liquid source.");
@@ -347,39 +384,26 @@ bool MapGenerator::generateRivers(const std::shared_ptr<MapWrapper> & map)
 bool MapGenerator::generateForests(const std::shared_ptr<MapWrapper> & map)
 {
     // List of locations for forests.
-    std::list<MapCell *> forestDropPoints;
-    // Lamba used to check if a cell is far away from pre-existing drop points
-    // and if it is nearby a source of water.
-    auto IsSuitable = [&](MapCell * cell)
-    {
-        // Check if the cell can host a forest.
-        if (!HasFlag(cell->terrain->generationFlags,
-                     TerrainGenerationFlags::CanHostForest))
-        {
-            return false;
-        }
-        // Check the distance from another forest drop point.
-        for (auto point : forestDropPoints)
-        {
-            auto distance = StructUtils::getDistance(cell->coordinates,
-                                                          point->coordinates);
-            if (distance <= configuration.minForestDistance)
-            {
-                return false;
-            }
-        }
-        return true;
-    };
-    // Retrieve all the starting points for rivers.
+    std::vector<MapCell *> forestDropPoints;
+    // The drop points hashed by position.
+    SpatialHash forestDropPointsHash(configuration.minForestDistance);
+    // Retrieve all the drop points for forests.
     for (auto x = 0; x < map->getWidth(); ++x)
     {
         for (auto y = 0; y < map->getHeight(); ++y)
         {
             auto cell = map->getCell(x, y);
-            // Check if it is a suitable cell.
-            if (IsSuitable(cell))
+            // Check if the cell can host a forest.
+            if (!HasFlag(cell->terrain->generationFlags,
+                         TerrainGenerationFlags::CanHostForest))
+            {
+                continue;
+            }
+            // Check the distance from another forest drop point.
+            if (forestDropPointsHash.isFarEnough(cell))
             {
                 forestDropPoints.emplace_back(cell);
+                forestDropPointsHash.add(cell);
             }
         }
     }
@@ -400,7 +424,7 @@ bool MapGenerator::generateForests(const std::shared_ptr<MapWrapper> & map)
         }
         auto normalized = Normalize(iterationLeft, 0, iterationTotal, 0,
                                     100);
-        if (TRand<int>(0, 100) >= normalized) return true;
+        if (this->randomInt(0, 100) >= normalized) return true;
         SetFlag(cell->flags, RoomFlags::SpawnTree);
         iterationLeft--;
         if (!FloodFill(std::max(x - 1, 0), y, iterationTotal, iterationLeft))
@@ -421,19 +445,22 @@ bool MapGenerator::generateForests(const std::shared_ptr<MapWrapper> & map)
                          iterationTotal,
                          iterationLeft);
     };
-    auto maxForestExpansion = TRand(3,
-                                    configuration.minForestDistance - 1);
-    // Number of dropped rivers.
+    auto maxForestExpansion = this->randomInt(
+        3, configuration.minForestDistance - 1);
+    // Number of dropped forests.
     auto iterations = std::min(static_cast<size_t>(configuration.numForests),
                                forestDropPoints.size());
     for (unsigned int it = 0; it < iterations; ++it)
     {
         // Pick a random forest drop point.
         auto dpIt = forestDropPoints.begin();
-        std::advance(dpIt,
-                     TRand<size_t>(0, forestDropPoints.size() - 1));
+        std::advance(dpIt, this->randomInt(
+            0, static_cast<int>(forestDropPoints.size()) - 1));
         MapCell * cell = (*dpIt);
-        forestDropPoints.erase(dpIt);
+        // Replace the picked point with the last one, the order of the
+        // remaining points is not relevant since they are picked randomly.
+        (*dpIt) = forestDropPoints.back();
+        forestDropPoints.pop_back();
         // Create the forest.
         if (!FloodFill(cell->coordinates.x,
                        cell->coordinates.y,
@@ -449,13 +476,56 @@ bool MapGenerator::generateForests(const std::shared_ptr<MapWrapper> & map)
 
 bool MapGenerator::resetZCoordinates(const std::shared_ptr<MapWrapper> & map)
 {
-    for (auto x = 0; x < map->getWidth(); ++x)
+    this->parallelBands(map->getWidth(), [&](int xBegin, int xEnd)
     {
-        for (auto y = 0; y < map->getHeight(); ++y)
+        for (auto x = xBegin; x < xEnd; ++x)
         {
-            auto cell = map->getCell(x, y);
-            cell->coordinates.z = 50;
+            for (auto y = 0; y < map->getHeight(); ++y)
+            {
+                map->getCell(x, y)->coordinates.z = 50;
+            }
         }
-    }
+    });
     return true;
 }
+
+void MapGenerator::parallelBands(
+    const int & width,
+    const std::function<void(int, int)> & body) const
+{
+    // Do not spawn more threads than columns.
+    auto bands = std::min(static_cast<int>(numThreads), width);
+    if (bands <= 1)
+    {
+        body(0, width);
+        return;
+    }
+    std::vector<std::thread> workers;
+    workers.reserve(static_cast<size_t>(bands - 1));
+    auto bandWidth = width / bands, remainder = width % bands;
+    auto xBegin = 0;
+    for (auto band = 0; band < bands; ++band)
+    {
+        auto xEnd = xBegin + bandWidth + ((band < remainder) ? 1 : 0);
+        // The last band is processed by the calling thread.
+        if (band == (bands - 1))
+        {
+            body(xBegin, xEnd);
+        }
+        else
+        {
+            workers.emplace_back(body, xBegin, xEnd);
+        }
+        xBegin = xEnd;
+    }
+    for (auto & worker : workers)
+    {
+        worker.join();
+    }
+}
+
+int MapGenerator::randomInt(const int & lowerBound, const int & upperBound)
+{
+    std::uniform_int_distribution<int> distribution(lowerBound, upperBound);
+    return distribution(generator);
+}
@@ -31,7 +31,9 @@ MapGeneratorConfiguration::MapGeneratorConfiguration() :
     numRivers(4),
     minRiverDistance(8),
     numForests(12),
-    minForestDistance(12)
+    minForestDistance(12),
+    seed(),
+    numThreads()
 {
     // Nothing to do.
 }
@@ -48,5 +50,7 @@ std::string MapGeneratorConfiguration::toString() const
     output += "MinRiverDistance  :" + ToString(minRiverDistance) + ";\n";
     output += "NumForests        :" + ToString(numForests) + ";\n";
     output += "MinForestDistance :" + ToString(minForestDistance) + ";\n";
+    output += "Seed              :" + ToString(seed) + ";\n";
+    output += "NumThreads        :" + ToString(numThreads) + ";\n";
     return output;
 }
\ No newline at end of file
@@ -28,7 +28,10 @@ MapWrapper::MapWrapper() :
     vnum(),
     width(),
     height(),
-    map()
+    map(),
+    airMap(),
+    buildArea(),
+    buildCursor()
 {
     // Nothing to do.
 }
@@ -38,6 +41,14 @@ MapWrapper::~MapWrapper()
     Logger::log(LogLevel::Trace, "Deleting map wrapper:%s", vnum);
 }
 
+void MapWrapper::setDimensions(const int & _width, const int & _height)
+{
+    width = std::max(_width, 0);
+    height = std::max(_height, 0);
+    map.clear();
+    map.resize(static_cast<size_t>(width * height));
+}
+
 void MapWrapper::destroy()
 {
     for (int x = 0; x < width; ++x)
@@ -55,6 +66,21 @@ void MapWrapper::destroy()
 bool MapWrapper::buildMap(const std::string & mapName,
                           const std::string & builder)
 {
+    if (!this->beginBuild(mapName, builder))
+    {
+        return false;
+    }
+    return this->buildStep(map.size() * 2);
+}
+
+bool MapWrapper::beginBuild(const std::string & mapName,
+                            const std::string & builder)
+{
+    if (buildArea != nullptr)
+    {
+        Logger::log(LogLevel::Error, "The map has already been built.\n");
+        return false;
+    }
     // -------------------------------------------------------------------------
     // First create a new area.
     auto area = new Area();
@@ -70,6 +96,7 @@ bool MapWrapper::buildMap(const std::string & mapName,
     if (!Mud::instance().addArea(area))
     {
         Logger::log(LogLevel::Error, "While adding the area to the MUD.\n");
+        delete (area);
         return false;
     }
     if (!SaveArea(area))
@@ -77,108 +104,144 @@ bool MapWrapper::buildMap(const std::string & mapName,
         Logger::log(LogLevel::Error, "While saving the area on the DB.\n");
         return false;
     }
-    // -------------------------------------------------------------------------
-    // Generate the normal rooms.
-    for (int x = 0; x < width; ++x)
+    buildArea = area;
+    buildCursor = 0;
+    return true;
+}
+
+bool MapWrapper::buildStep(const size_t & maxSteps)
+{
+    if (buildArea == nullptr)
     {
-        for (int y = 0; y < height; ++y)
+        Logger::log(LogLevel::Error, "The map build has not been started.\n");
+        return false;
+    }
+    for (size_t step = 0; (step < maxSteps) && !this->isBuilt(); ++step)
+    {
+        // Generate the normal rooms, then the exits.
+        auto result = (buildCursor < map.size()) ?
+                      this->buildRoom(&map[buildCursor]) :
+                      this->buildExits(&map[buildCursor - map.size()]);
+        if (!result)
         {
-            auto cell = this->getCell(x, y);
-            cell->room = new Room();
-            cell->room->vnum = Mud::instance().getMaxVnumRoom() + 1;
-            cell->room->area = area;
-            cell->room->coord = cell->coordinates;
-            cell->room->terrain = cell->terrain;
-            cell->room->name = cell->terrain->name;
-            cell->room->liquidContent = cell->liquidContent;
-            cell->room->description = "";
-            cell->room->flags = cell->flags;
-            // Add the created room to the room_map.
-            if (!Mud::instance().addRoom(cell->room))
-            {
-                Logger::log(LogLevel::Error,
-                            "Cannot add the room to the mud.\n");
-                return false;
-            }
-            if (!cell->room->area->addRoom(cell->room))
-            {
-                Logger::log(LogLevel::Error,
-                            "Cannot add the room to the area.\n");
-                return false;
-            }
-            if (!SaveRoom(cell->room))
-            {
-                Logger::log(LogLevel::Error,
-                            "While saving the room on DB.\n");
-                return false;
-            }
-            if (!SaveAreaList(area, cell->room))
-            {
-                Logger::log(LogLevel::Error,
-                            "While saving the Area List.\n");
-                return false;
-            }
-            Logger::log(LogLevel::Debug, "Created room at %s",
-                        cell->room->coord.toString());
+            return false;
         }
+        ++buildCursor;
     }
-    // -------------------------------------------------------------------------
-    // Generate the exits.
-    for (int x = 0; x < width; ++x)
+    return true;
+}
+
+unsigned int MapWrapper::getBuildProgress() const
+{
+    if (map.empty()) return 100;
+    return static_cast<unsigned int>((buildCursor * 100) / (map.size() * 2));
+}
+
+std::string MapWrapper::drawMap() const
+{
+    std::string drawnMap;
+    for (int y = 0; y < height; ++y)
     {
-        for (int y = 0; y < height; ++y)
+        for (int x = 0; x < width; ++x)
         {
-            auto cell = this->getCell(x, y);
-            if (cell->room == nullptr)
+            drawnMap += map[static_cast<size_t>(x * height + y)].getTile();
+        }
+        drawnMap += "\n";
+    }
+    return drawnMap;
+}
+
+bool MapWrapper::buildRoom(MapCell * cell)
+{
+    cell->room = new Room();
+    cell->room->vnum = Mud::instance().getMaxVnumRoom() + 1;
+    cell->room->area = buildArea;
+    cell->room->coord = cell->coordinates;
+    cell->room->terrain = cell->terrain;
+    cell->room->name = cell->terrain->name;
+    cell->room->liquidContent = cell->liquidContent;
+    cell->room->description = "";
+    cell->room->flags = cell->flags;
+    // Add the created room to the room_map.
+    if (!Mud::instance().addRoom(cell->room))
+    {
+        Logger::log(LogLevel::Error,
+                    "Cannot add the room to the mud.\n");
+        return false;
+    }
+    if (!cell->room->area->addRoom(cell->room))
+    {
+        Logger::log(LogLevel::Error,
+                    "Cannot add the room to the area.\n");
+        return false;
+    }
+    if (!SaveRoom(cell->room))
+    {
+        Logger::log(LogLevel::Error,
+                    "While saving the room on DB.\n");
+        return false;
+    }
+    if (!SaveAreaList(buildArea, cell->room))
+    {
+        Logger::log(LogLevel::Error,
+                    "While saving the Area List.\n");
+        return false;
+    }
+    Logger::log(LogLevel::Debug, "Created room at %s",
+                cell->room->coord.toString());
+    return true;
+}
+
+bool MapWrapper::buildExits(MapCell * cell)
+{
+    if (cell->room == nullptr)
+    {
+        Logger::log(LogLevel::Error,
+                    "A cell has a nullptr room at %s.\n",
+                    cell->coordinates.toString());
+        return false;
+    }
+    for (auto neighbour : cell->neighbours)
+    {
+        // Get the room of the neighbour.
+        if (neighbour.second->room == nullptr)
+        {
+            Logger::log(LogLevel::Error,
+                        "A neighbour has a nullptr room %s->%s.\n",
+                        cell->coordinates.toString(),
+                        neighbour.second->coordinates.toString());
+            return false;
+        }
+        // Create the two exits.
+        auto forward = std::make_shared<Exit>(
+            cell->room,
+            neighbour.second->room,
+            neighbour.first,
+            0);
+        auto backward = std::make_shared<Exit>(
+            neighbour.second->room,
+            cell->room,
+            neighbour.first.getOpposite(),
+            0);
+        // Insert in both the rooms exits the connection.
+        if (cell->room->addExit(forward))
+        {
+            if (!SaveRoomExit(forward))
             {
                 Logger::log(LogLevel::Error,
-                            "A cell has a nullptr room at %s.\n",
-                            cell->coordinates.toString());
+                            "While saving the exit on DB.\n");
                 return false;
             }
-            for (auto neighbour : cell->neighbours)
+        }
+        if (neighbour.second->room->addExit(backward))
+        {
+            if (!SaveRoomExit(backward))
             {
-                // Get the room of the neighbour.
-                if (neighbour.second->room == nullptr)
-                {
-                    Logger::log(LogLevel::Error,
-                                "A neighbour has a nullptr room %s->%s.\n",
-                                cell->coordinates.toString(),
-                                neighbour.second->coordinates.toString());
-                    return false;
-                }
-                // Create the two exits.
-                auto forward = std::make_shared<Exit>(
-                    cell->room,
-                    neighbour.second->room,
-                    neighbour.first,
-                    0);
-                auto backward = std::make_shared<Exit>(
-                    neighbour.second->room,
-                    cell->room,
-                    neighbour.first.getOpposite(),
-                    0);
-                // Insert in both the rooms exits the connection.
-                if (cell->room->addExit(forward))
-                {
-                    if (!SaveRoomExit(forward))
-                    {
-                        Logger::log(LogLevel::Error,
-                                    "While saving the exit on DB.\n");
-                        return false;
-                    }
-                }
-                if (neighbour.second->room->addExit(backward))
-                {
-                    if (!SaveRoomExit(backward))
-                    {
-                        Logger::log(LogLevel::Error,
-                                    "While saving the exit on DB.\n");
-                        return false;
-                    }
-                }
+                Logger::log(LogLevel::Error,
+                            "While saving the exit on DB.\n");
+                return false;
             }
         }
     }
     return true;
-}
\ No newline at end of file
+}
@@ -27,6 +27,7 @@
 #include "item/subitem/lightItem.hpp"
 #include "structure/generator.hpp"
 #include "utilities/logger.hpp"
+#include "utilities/slabPool.hpp"
 #include "mud.hpp"
 #include "structure/structureUtils.hpp"
 
@@ -41,7 +42,11 @@ Room::Room() :
     items(),
     characters(),
     flags(),
-    liquidContent()
+    liquidContent(),
+    characterIndex(),
+    itemIndex(),
+    craftingIndex(),
+    observers()
 {
     // Nothing to do.
 }
@@ -56,6 +61,11 @@ Room::~Room()
             oppositeExit->unlink();
         }
     }
+    // Remove the room from the areas of interest of its observers.
+    for (auto observer : observers)
+    {
+        observer->areaOfInterest.forget(this);
+    }
     // Remove the room from the area.
     if (area != nullptr)
     {
@@ -67,6 +77,16 @@ Room::~Room()
 //                name);
 }
 
+void * Room::operator new(size_t size)
+{
+    return SlabAllocator::allocate("Room", size);
+}
+
+void Room::operator delete(void * pointer, size_t size)
+{
+    SlabAllocator::deallocate("Room", pointer, size);
+}
+
 bool Room::check(bool complete)
 {
     if (vnum <= 0) return false;
@@ -86,6 +106,9 @@ void Room::addItem(Item *& item, bool updateDB)
 {
     // Add the item.
     items.push_back_item(item);
+    // Index the item, if it has not been stacked with another one.
+    itemIndex.add(item, item->getKeys());
+    craftingIndex.add(item);
     // Set the room attribute of the item.
     item->room = this;
     // Update the database.
@@ -120,13 +143,26 @@ void Room::addBuilding(Item * item, bool updateDB)
 void Room::addCharacter(Character * character)
 {
     characters.push_back(character);
+    // Index the character by its keys.
+    if (character->isMobile())
+    {
+        characterIndex.add(character, character->toMobile()->keys);
+    }
+    else
+    {
+        characterIndex.add(character, {character->getName()});
+    }
     character->room = this;
+    // Update the rooms in sight of the character.
+    character->areaOfInterest.update();
 }
 
 bool Room::removeItem(Item * item, bool updateDB)
 {
     if (items.removeItem(item))
     {
+        itemIndex.remove(item);
+        craftingIndex.remove(item);
         item->room = nullptr;
         // Update the database.
         if (updateDB && (item->getType() != ModelType::Corpse))
@@ -163,6 +199,7 @@ void Room::removeCharacter(Character * character)
     {
         if ((*it)->name == character->name)
         {
+            characterIndex.remove(*it);
             characters.erase(it);
             character->room = nullptr;
             return;
@@ -254,10 +291,9 @@ bool Room::removeOnDB()
 
 Item * Room::findBuilding(std::string target, int & number)
 {
-    for (auto iterator : items)
+    for (auto iterator : itemIndex.find(ToLower(target)))
     {
-        if (iterator->hasKey(ToLower(target)) &&
-            HasFlag(iterator->flags, ItemFlag::Built))
+        if (HasFlag(iterator->flags, ItemFlag::Built))
         {
             if (number == 1)
             {
@@ -295,15 +331,60 @@ ItemVector Room::findBuildings(ModelType type)
     return buildingsList;
 }
 
+Item * Room::findItem(std::string const & key, int & number) const
+{
+    for (auto item : itemIndex.find(ToLower(key)))
+    {
+        if (number == 1) return item;
+        --number;
+    }
+    return nullptr;
+}
+
+void Room::orderItemsBy(const ItemVector::Order & order)
+{
+    items.orderBy(order);
+    // Keep the numbering used to target the items consistent with the order.
+    itemIndex.reorder(items);
+}
+
+Character * Room::findCharacter(
+    std::string const & target,
+    int & number,
+    std::vector<Character *> const & exceptions,
+    bool skipMobile,
+    bool skipPlayer) const
+{
+    for (auto character : characterIndex.find(ToLower(target)))
+    {
+        if (character->isMobile())
+        {
+            if (skipMobile) continue;
+        }
+        else if (skipPlayer || !character->toPlayer()->isPlaying())
+        {
+            continue;
+        }
+        if (std::find(exceptions.begin(), exceptions.end(), character) !=
+            exceptions.end())
+        {
+            continue;
+        }
+        if (number == 1) return character;
+        --number;
+    }
+    return nullptr;
+}
+
 Player * Room::findPlayer(
     std::string target,
     int & number,
     const std::vector<Character *> & exceptions) const
 {
-    Character * foundCharacter = characters.findCharacter(target,
-                                                          number,
-                                                          exceptions,
-                                                          true);
+    Character * foundCharacter = this->findCharacter(target,
+                                                     number,
+                                                     exceptions,
+                                                     true);
     if (foundCharacter != nullptr)
     {
         return foundCharacter->toPlayer();
@@ -316,11 +397,11 @@ Mobile * Room::findMobile(
     int & number,
     const std::vector<Character *> & exceptions) const
 {
-    Character * foundCharacter = characters.findCharacter(target,
-                                                          number,
-                                                          exceptions,
-                                                          false,
-                                                          true);
+    Character * foundCharacter = this->findCharacter(target,
+                                                     number,
+                                                     exceptions,
+                                                     false,
+                                                     true);
     if (foundCharacter != nullptr)
     {
         return foundCharacter->toMobile();
@@ -487,9 +568,11 @@ std::string Room::getLook(Character * actor)
     // Show the characters/items inside the room only if it is lit.
     if (roomIsLit)
     {
-        // List all the items placed in the same room.
-        for (auto it : items)
+        // List all the items placed in the same room, grouping the equal
+        // ones.
+        for (auto const & group : items.toStack())
         {
+            auto it = group.item;
             // If the item is invisible, don't show it.
             if (HasFlag(it->model->modelFlags, ModelFlag::Invisible))
             {
@@ -500,11 +583,11 @@ std::string Room::getLook(Character * actor)
                 output += "[B]";
             }
             // If there are more of this item, show the counter.
-            if (it->quantity > 1)
+            if (group.quantity > 1)
             {
                 output += Formatter::cyan() + it->getNameCapital() +
                           Formatter::reset() + " are here.[" +
-                          ToString(it->quantity) + "]\n";
+                          ToString(group.quantity) + "]\n";
             }
             else
             {
@@ -539,23 +622,35 @@ std::string Room::getLook(Character * actor)
 void Room::sendToAll(const std::string & message,
                      const std::vector<Character *> & exceptions)
 {
+    // Each call uses a new mark, so that the exceptions are flagged without
+    // having to clear the marks left by the previous calls.
+    static unsigned long lastMark = 0;
+    auto mark = ++lastMark;
+    for (auto exception : exceptions)
+    {
+        exception->messageMark = mark;
+    }
+    // Format the message once and share it among the recipients.
+    SharedMessage shared;
     for (auto iterator : characters)
     {
-        if (!exceptions.empty())
+        if (iterator->messageMark == mark)
         {
-            if (std::find(exceptions.begin(), exceptions.end(), iterator) !=
-                exceptions.end())
-            {
-                continue;
-            }
+            continue;
+        }
+        if (!shared)
+        {
+            shared = std::make_shared<const std::string>(message + "\n");
         }
-        iterator->sendMsg(message + "\n");
+        iterator->sendMsg(shared);
     }
 }
 
 void Room::funcSendToAll(const std::string & message,
                          std::function<bool(Character * character)> checkException)
 {
+    // Format the message once and share it among the recipients.
+    SharedMessage shared;
     for (auto iterator : characters)
     {
         if (checkException)
@@ -565,7 +660,54 @@ void Room::funcSendToAll(const std::string & message,
                 continue;
             }
         }
-        iterator->sendMsg(message + "\n");
+        if (!shared)
+        {
+            shared = std::make_shared<const std::string>(message + "\n");
+        }
+        iterator->sendMsg(shared);
+    }
+}
+
+void Room::addObserver(Character * character)
+{
+    observers.emplace_back(character);
+}
+
+void Room::removeObserver(Character * character)
+{
+    auto it = std::find(observers.begin(), observers.end(), character);
+    if (it != observers.end())
+    {
+        // The order of the observers is not relevant.
+        *it = observers.back();
+        observers.pop_back();
+    }
+}
+
+void Room::funcSendToObservers(const std::string & message,
+                               std::function<bool(Character * character)> checkException)
+{
+    // Format the message once and share it among the recipients.
+    SharedMessage shared;
+    for (auto observer : observers)
+    {
+        // Skip the characters which have been removed from the world.
+        if (observer->room == nullptr)
+        {
+            continue;
+        }
+        if (checkException)
+        {
+            if (!checkException(observer))
+            {
+                continue;
+            }
+        }
+        if (!shared)
+        {
+            shared = std::make_shared<const std::string>(message + "\n");
+        }
+        observer->sendMsg(shared);
     }
 }
 
@@ -167,15 +167,12 @@ bool checkConnection(const MovementOptions & options,
             // Check if the character is locked into close combat.
             bool lockedInCombat = false;
             // Check if he is in the same room of one of its aggressors.
-            for (auto iterator : character->combatHandler)
+            for (auto const & iterator : character->combatHandler)
             {
-                if (iterator->aggressor != nullptr)
+                if (iterator.aggressor->room == character->room)
                 {
-                    if (iterator->aggressor->room == character->room)
-                    {
-                        lockedInCombat = true;
-                        break;
-                    }
+                    lockedInCombat = true;
+                    break;
                 }
             }
             // Check even the aimed character.
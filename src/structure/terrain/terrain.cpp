@@ -21,7 +21,6 @@
 /// DEALINGS IN THE SOFTWARE.
 
 #include "structure/terrain/terrain.hpp"
-#include "utilities/utils.hpp"
 
 Terrain::Terrain() :
     vnum(),
@@ -50,13 +49,14 @@ void Terrain::addLiquidSource(Liquid * _liquid,
     liquidSources.emplace_back(std::move(ls));
 }
 
-Liquid * Terrain::getRandomLiquidSource() const
+Liquid * Terrain::getRandomLiquidSource(std::mt19937 & generator) const
 {
     if (!liquidSources.empty())
     {
-        auto pickedValue = TRand<unsigned int>(
+        std::uniform_int_distribution<unsigned int> distribution(
             0, liquidSources.back().cumulativeProbability - 1);
-        for (auto liquidSource : liquidSources)
+        auto pickedValue = distribution(generator);
+        for (auto const & liquidSource : liquidSources)
         {
             if (pickedValue <= liquidSource.cumulativeProbability)
             {
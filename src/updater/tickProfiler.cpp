@@ -0,0 +1,202 @@
+/// @file   tickProfiler.cpp
+/// @brief  Implements the profiler of the mud cycles.
+/// @author Enrico Fraccaroli
+/// @date   Oct 19 2026
+/// @copyright
+/// Copyright (c) 2016 Enrico Fraccaroli <enrico.fraccaroli@gmail.com>
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///     The above copyright notice and this permission notice shall be included
+///     in all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+
+#include "updater/tickProfiler.hpp"
+#include "utilities/logger.hpp"
+#include "utilities/utils.hpp"
+
+#include <algorithm>
+
+TickProfiler::TickProfiler() :
+    tickStopwatch(""),
+    currentPhases(),
+    phases(),
+    commands(),
+    slowTicks(),
+    ticks(),
+    ticksTotal(),
+    ticksMax(),
+    budget(100000)
+{
+    // Nothing to do.
+}
+
+TickProfiler::~TickProfiler()
+{
+    // Nothing to do.
+}
+
+TickProfiler & TickProfiler::instance()
+{
+    // Since it's a static variable, if the class has already been created,
+    // It won't be created again. And it **is** thread-safe in C++11.
+    static TickProfiler instance;
+    // Return a reference to our instance.
+    return instance;
+}
+
+void TickProfiler::beginTick()
+{
+    currentPhases.fill(0);
+    tickStopwatch.start();
+}
+
+void TickProfiler::endTick()
+{
+    // Do not count the time spent waiting for the sockets.
+    auto duration = tickStopwatch.stop() -
+                    currentPhases[static_cast<size_t>(TickPhase::Select)];
+    ++ticks;
+    ticksTotal += duration;
+    ticksMax = std::max(ticksMax, duration);
+    for (size_t it = 0; it < numPhases; ++it)
+    {
+        phases[it].total += currentPhases[it];
+        phases[it].max = std::max(phases[it].max, currentPhases[it]);
+    }
+    if (duration <= budget)
+    {
+        return;
+    }
+    auto breakdown = TickProfiler::phasesToString(currentPhases);
+    Logger::log(LogLevel::Warning,
+                "Slow tick: %s ms out of %s ms [%s]",
+                ToString(duration / 1000),
+                ToString(budget / 1000),
+                breakdown);
+    if (slowTicks.size() == maxSlowTicks)
+    {
+        slowTicks.pop_front();
+    }
+    slowTicks.push_back(SlowTick{GetFormattedTime(), duration, currentPhases});
+}
+
+void TickProfiler::addPhaseTime(const TickPhase & phase,
+                                const double & elapsed)
+{
+    currentPhases[static_cast<size_t>(phase)] += elapsed;
+}
+
+void TickProfiler::addCommandTime(const std::string & name,
+                                  const double & elapsed)
+{
+    auto & stats = commands[name];
+    ++stats.count;
+    stats.total += elapsed;
+    stats.max = std::max(stats.max, elapsed);
+    // The buckets are limited by powers of ten, starting from 100 us.
+    size_t bucket = 0;
+    for (double limit = 100; (elapsed >= limit) && (bucket < numBuckets - 1);
+         limit *= 10)
+    {
+        ++bucket;
+    }
+    ++stats.buckets[bucket];
+}
+
+void TickProfiler::setBudget(const double & milliseconds)
+{
+    budget = milliseconds * 1000;
+}
+
+double TickProfiler::getBudget() const
+{
+    return budget / 1000;
+}
+
+void TickProfiler::reset()
+{
+    phases.fill(PhaseStats());
+    commands.clear();
+    slowTicks.clear();
+    ticks = 0;
+    ticksTotal = 0;
+    ticksMax = 0;
+}
+
+double TickProfiler::getAverageTick() const
+{
+    return (ticks == 0) ? 0 : (ticksTotal / ticks);
+}
+
+const TickProfiler::PhaseStats & TickProfiler::getPhaseStats(
+    const TickPhase & phase) const
+{
+    return phases[static_cast<size_t>(phase)];
+}
+
+std::string TickProfiler::phaseToString(const TickPhase & phase)
+{
+    if (phase == TickPhase::Characters) return "Characters";
+    if (phase == TickPhase::Items) return "Items";
+    if (phase == TickPhase::Hour) return "Hour";
+    if (phase == TickPhase::Actions) return "Actions";
+    if (phase == TickPhase::MapGeneration) return "MapGeneration";
+    if (phase == TickPhase::ItemDestruction) return "ItemDestruction";
+    if (phase == TickPhase::InactivePlayers) return "InactivePlayers";
+    if (phase == TickPhase::Select) return "Select";
+    if (phase == TickPhase::Accept) return "Accept";
+    if (phase == TickPhase::Read) return "Read";
+    return "Write";
+}
+
+std::string TickProfiler::bucketToString(const size_t & bucket)
+{
+    if (bucket == 0) return "<0.1ms";
+    if (bucket == 1) return "<1ms";
+    if (bucket == 2) return "<10ms";
+    if (bucket == 3) return "<100ms";
+    if (bucket == 4) return "<1s";
+    return ">=1s";
+}
+
+std::string TickProfiler::phasesToString(
+    const std::array<double, numPhases> & timings)
+{
+    std::string output;
+    for (size_t it = 0; it < numPhases; ++it)
+    {
+        if (timings[it] <= 0)
+        {
+            continue;
+        }
+        if (!output.empty())
+        {
+            output += ", ";
+        }
+        output += TickProfiler::phaseToString(static_cast<TickPhase>(it));
+        output += " " + ToString(timings[it] / 1000) + " ms";
+    }
+    return output;
+}
+
+ProfilePhase::ProfilePhase(const TickPhase & _phase) :
+    phase(_phase),
+    stopwatch("")
+{
+    // Nothing to do.
+}
+
+ProfilePhase::~ProfilePhase()
+{
+    TickProfiler::instance().addPhaseTime(phase, stopwatch.stop());
+}
@@ -22,6 +22,7 @@
 
 #include "utilities/logger.hpp"
 #include "updater/updater.hpp"
+#include "updater/tickProfiler.hpp"
 #include "character/behaviour/generalBehaviour.hpp"
 #include "mud.hpp"
 
@@ -42,6 +43,10 @@ MudUpdater::MudUpdater() :
     hourTicCounter(),
     mudHour(),
     mudDayPhase(DayPhase::Day),
+    mapBuildSteps(256),
+    workerPool(),
+    tickingItems(),
+    decayingItems(),
     itemToDestroy()
 {
     // Nothing to do.
@@ -76,6 +81,34 @@ void MudUpdater::updateBandUncompressed(const size_t & size)
     bandwidth_uncompressed += size;
 }
 
+void MudUpdater::registerItem(Item * item)
+{
+    if (item->needsTic())
+    {
+        tickingItems.insert(std::make_pair(item->vnum, item));
+    }
+    if (item->canDecay())
+    {
+        decayingItems.insert(std::make_pair(item->vnum, item));
+    }
+}
+
+void MudUpdater::unregisterItem(Item * item)
+{
+    tickingItems.erase(item->vnum);
+    decayingItems.erase(item->vnum);
+}
+
+size_t MudUpdater::getTickingItemsCount() const
+{
+    return tickingItems.size();
+}
+
+size_t MudUpdater::getDecayingItemsCount() const
+{
+    return decayingItems.size();
+}
+
 void MudUpdater::addItemToDestroy(Item * item)
 {
     itemToDestroy.insert(itemToDestroy.end(), item);
@@ -121,29 +154,30 @@ void MudUpdater::advanceTime()
     // Check if a tic is passed.
     if (this->hasTicPassed())
     {
-        // [TIC] Update the Players.
-        for (auto iterator : Mud::instance().mudPlayers)
-        {
-            iterator->updateTic();
-        }
-        // [TIC] Update the Mobiles.
-        for (auto iterator : Mud::instance().mudMobiles)
-        {
-            iterator->updateTic();
-        }
-        // [TIC] Update the Items.
-        for (auto iterator : Mud::instance().mudItems)
+        // [TIC] Update the Players and the Mobiles.
         {
-            iterator.second->updateTic();
+            ProfilePhase profile(TickPhase::Characters);
+            this->updateCharactersTic();
         }
-        // [TIC] Update the Rooms.
-        for (auto iterator : Mud::instance().mudRooms)
+        // [TIC] Update the Items which need it, dropping the ones which
+        // do not need it anymore.
         {
-            iterator.second->updateTic();
+            ProfilePhase profile(TickPhase::Items);
+            for (auto it = tickingItems.begin(); it != tickingItems.end();)
+            {
+                if (!it->second->needsTic())
+                {
+                    it = tickingItems.erase(it);
+                    continue;
+                }
+                (it++)->second->updateTic();
+            }
         }
+        // The Rooms have no time-dependent state, so they are not updated.
         // Check if a hour is passed.
         if (hourTicCounter++ >= hourTicSize)
         {
+            ProfilePhase profile(TickPhase::Hour);
             // [HOUR] Update the day phase.
             this->updateDayPhase();
             // [HOUR] Update the Players.
@@ -156,39 +190,40 @@ void MudUpdater::advanceTime()
             {
                 iterator->updateHour();
             }
-            // [HOUR] Update the Corpses.
-            for (auto it : Mud::instance().mudCorpses)
-            {
-                it.second->updateHour();
-            }
-            // [HOUR] Update the Items.
-            for (auto it : Mud::instance().mudItems)
-            {
-                it.second->updateHour();
-            }
-            // [HOUR] Update the Rooms.
-            for (auto iterator : Mud::instance().mudRooms)
+            // [HOUR] Update the Corpses and the Items, whose hourly update
+            // consists only of their decay.
+            std::vector<Item *> items;
+            items.reserve(decayingItems.size());
+            for (auto it : decayingItems)
             {
-                iterator.second->updateHour();
+                items.emplace_back(it.second);
             }
+            this->updateItemsDecay(items);
             // [HOUR] Reset the hour counter.
             hourTicCounter = 0;
         }
     }
     // [DELTA] Perform characters pending actions.
-    this->performActions();
+    {
+        ProfilePhase profile(TickPhase::Actions);
+        this->performActions();
+    }
+    // [DELTA] Collect the generated maps and continue their build.
+    {
+        ProfilePhase profile(TickPhase::MapGeneration);
+        this->updateMapGeneration();
+    }
     // [DELTA] Destroy all the registered items.
-    for (auto it = itemToDestroy.begin(); it != itemToDestroy.end(); ++it)
+    ProfilePhase profile(TickPhase::ItemDestruction);
+    while (!itemToDestroy.empty())
     {
-        // Back-up the iterator.
-        auto currentIt = it++;
         // Delete the item.
-        auto item = (*currentIt);
+        auto item = itemToDestroy.front();
         item->removeFromMud();
         item->removeOnDB();
         delete (item);
         // Erase the element.
-        itemToDestroy.erase(currentIt);
+        itemToDestroy.pop_front();
     }
 }
 
@@ -274,3 +309,130 @@ void MudUpdater::performActions()
         mobile->performAction();
     }
 }
+
+void MudUpdater::updateCharactersTic()
+{
+    std::vector<Character *> characters;
+    characters.reserve(Mud::instance().mudPlayers.size() +
+                       Mud::instance().mudMobiles.size());
+    for (auto player : Mud::instance().mudPlayers)
+    {
+        // Only the players which are playing are updated.
+        if (player->isPlaying())
+        {
+            characters.emplace_back(player);
+        }
+    }
+    for (auto mobile : Mud::instance().mudMobiles)
+    {
+        if (mobile->isAlive())
+        {
+            characters.emplace_back(mobile);
+        }
+        else if (mobile->canRespawn())
+        {
+            // Respawning moves the mobile, so it is done serially.
+            mobile->respawn();
+        }
+    }
+    // Compute the changes of each character in parallel.
+    workerPool.parallelFor(characters.size(),
+                           [&](size_t begin, size_t end, size_t)
+                           {
+                               for (auto i = begin; i < end; ++i)
+                               {
+                                   characters[i]->computeTic();
+                               }
+                           });
+    // Apply serially the changes which involve the rest of the mud.
+    for (auto character : characters)
+    {
+        character->applyTic();
+    }
+}
+
+void MudUpdater::updateItemsDecay(const std::vector<Item *> & items)
+{
+    // Each band collects its broken items inside its own buffer.
+    std::vector<std::vector<Item *>> broken(workerPool.size());
+    workerPool.parallelFor(items.size(),
+                           [&](size_t begin, size_t end, size_t band)
+                           {
+                               for (auto i = begin; i < end; ++i)
+                               {
+                                   if (items[i]->decay())
+                                   {
+                                       broken[band].emplace_back(items[i]);
+                                   }
+                               }
+                           });
+    // The bands are contiguous, so the items are broken down in the same
+    // order in which they have been given.
+    for (auto const & buffer : broken)
+    {
+        for (auto item : buffer)
+        {
+            item->breakDown();
+        }
+    }
+}
+
+void MudUpdater::updateMapGeneration()
+{
+    auto & jobs = Mud::instance().mudMapJobs;
+    for (auto it = jobs.begin(); it != jobs.end();)
+    {
+        auto job = it->second;
+        if (job->getStatus() == MapGenerationStatus::Running)
+        {
+            ++it;
+            continue;
+        }
+        Character * owner = Mud::instance().findPlayer(job->owner);
+        if (job->getStatus() == MapGenerationStatus::Completed)
+        {
+            auto map = job->getMap();
+            // Add the map to the list of generated maps.
+            Mud::instance().addGeneratedMap(map);
+            if (owner != nullptr)
+            {
+                owner->sendMsg("The generation of map %s is completed.\n",
+                               map->vnum);
+                owner->sendMsg(job->getConfiguration().toString());
+                owner->sendMsg(map->drawMap());
+                owner->sendMsg(Formatter::reset());
+            }
+        }
+        else if (owner != nullptr)
+        {
+            owner->sendMsg("The generation of map %s is %s.\n",
+                           job->id, ToLower(job->getStatusString()));
+        }
+        it = jobs.erase(it);
+    }
+    for (auto it : Mud::instance().mudGeneratedMaps)
+    {
+        auto map = it.second;
+        if (!map->isBuilding())
+        {
+            continue;
+        }
+        Character * owner = Mud::instance().findPlayer(
+            map->buildArea->builder);
+        if (!map->buildStep(mapBuildSteps))
+        {
+            Logger::log(LogLevel::Error, "Can't build the map '%s'.",
+                        map->vnum);
+            // Stop the build, the rooms created so far are kept.
+            map->buildCursor = map->map.size() * 2;
+            if (owner != nullptr)
+            {
+                owner->sendMsg("Can't build the map '%s'.\n", map->vnum);
+            }
+        }
+        else if (map->isBuilt() && (owner != nullptr))
+        {
+            owner->sendMsg("The map %s has been built.\n", map->vnum);
+        }
+    }
+}
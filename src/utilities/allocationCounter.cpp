@@ -0,0 +1,91 @@
+/// @file   allocationCounter.cpp
+/// @brief  Implements the functions used to count the allocations.
+/// @author Enrico Fraccaroli
+/// @date   Oct 19 2026
+/// @copyright
+/// Copyright (c) 2016 Enrico Fraccaroli <enrico.fraccaroli@gmail.com>
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///     The above copyright notice and this permission notice shall be included
+///     in all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+
+#include "utilities/allocationCounter.hpp"
+
+#ifdef RADMUD_COUNT_ALLOCATIONS
+
+#include <cstdlib>
+#include <new>
+
+/// The number of allocations performed by the thread.
+static thread_local unsigned long allocations = 0;
+
+void * operator new(std::size_t size)
+{
+    ++allocations;
+    auto pointer = std::malloc((size == 0) ? 1 : size);
+    if (pointer == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return pointer;
+}
+
+void * operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void * pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete[](void * pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void * pointer, std::size_t) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete[](void * pointer, std::size_t) noexcept
+{
+    std::free(pointer);
+}
+
+bool AllocationCounter::isEnabled()
+{
+    return true;
+}
+
+unsigned long AllocationCounter::getCount()
+{
+    return allocations;
+}
+
+#else
+
+bool AllocationCounter::isEnabled()
+{
+    return false;
+}
+
+unsigned long AllocationCounter::getCount()
+{
+    return 0;
+}
+
+#endif
@@ -0,0 +1,371 @@
+/// @file   logBackend.cpp
+/// @brief  Implement the asynchronous backend of the logger.
+/// @author Enrico Fraccaroli
+/// @date   Oct 19 2026
+/// @copyright
+/// Copyright (c) 2016 Enrico Fraccaroli <enrico.fraccaroli@gmail.com>
+/// Permission to use, copy, modify, and distribute this software for any
+/// purpose with or without fee is hereby granted, provided that the above
+/// copyright notice and this permission notice appear in all copies.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+/// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+/// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+/// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+/// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+/// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+/// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#include "utilities/logBackend.hpp"
+#include "utilities/logger.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <sstream>
+
+/// @brief Marks the ring of a thread as closed when the thread terminates.
+struct LocalRingHolder
+{
+    /// The ring of the thread.
+    std::shared_ptr<LogRing> ring;
+
+    /// @brief Destructor.
+    ~LocalRingHolder();
+};
+
+/// The ring of the calling thread, or the holder itself once the thread
+///  has started to terminate.
+static thread_local void * localRing = nullptr;
+
+LocalRingHolder::~LocalRingHolder()
+{
+    if (ring != nullptr)
+    {
+        ring->closed.store(true, std::memory_order_release);
+    }
+    localRing = this;
+}
+
+LogRing::LogRing(const size_t & capacity) :
+    slots(capacity),
+    head(),
+    tail(),
+    closed()
+{
+    // Nothing to do.
+}
+
+bool LogRing::push(LogEntry & entry)
+{
+    auto current = tail.load(std::memory_order_relaxed);
+    auto next = (current + 1) % slots.size();
+    if (next == head.load(std::memory_order_acquire))
+    {
+        return false;
+    }
+    slots[current] = std::move(entry);
+    tail.store(next, std::memory_order_release);
+    return true;
+}
+
+bool LogRing::pop(LogEntry & entry)
+{
+    auto current = head.load(std::memory_order_relaxed);
+    if (current == tail.load(std::memory_order_acquire))
+    {
+        return false;
+    }
+    entry = std::move(slots[current]);
+    head.store((current + 1) % slots.size(), std::memory_order_release);
+    return true;
+}
+
+size_t LogRing::size() const
+{
+    auto first = head.load(std::memory_order_acquire);
+    auto last = tail.load(std::memory_order_acquire);
+    return (last + slots.size() - first) % slots.size();
+}
+
+LogBackend::LogBackend() :
+    stream(),
+    streamMutex(),
+    fileSize(),
+    index(),
+    rings(),
+    ringsMutex(),
+    sequence(),
+    dropped(),
+    reportedDrops(),
+    writerMutex(),
+    wakeUp(),
+    flushed(),
+    flushRequested(),
+    flushCompleted(),
+    stopping(),
+    running(true),
+    writer()
+{
+    writer = std::thread(&LogBackend::writerLoop, this);
+    // Write what is left before the static objects are destroyed, the
+    // messages logged afterwards are written synchronously.
+    std::atexit([]()
+                {
+                    LogBackend::instance().stop();
+                });
+}
+
+LogBackend::~LogBackend()
+{
+    // Nothing to do.
+}
+
+LogBackend & LogBackend::instance()
+{
+    // The backend is intentionally leaked, so that it can be used even
+    // while the static objects are being destroyed.
+    static LogBackend * instance = new LogBackend();
+    return *instance;
+}
+
+bool LogBackend::open(const std::string & filename)
+{
+    std::lock_guard<std::mutex> lock(streamMutex);
+    if (!stream.is_open())
+    {
+        stream.open(filename.c_str(),
+                    std::ios::in | std::ios::out | std::ios::app);
+        if (stream.is_open())
+        {
+            stream.seekg(0, std::ios::end);
+            fileSize = std::max(std::streamoff(0),
+                                std::streamoff(stream.tellg()));
+            index.open(filename, fileSize);
+        }
+    }
+    return stream.is_open();
+}
+
+void LogBackend::push(const LogLevel_t & level, std::string message)
+{
+    LogEntry entry{
+        sequence.fetch_add(1, std::memory_order_relaxed),
+        level,
+        std::this_thread::get_id(),
+        time(nullptr),
+        std::move(message)
+    };
+    LogRing * ring = nullptr;
+    if (running.load(std::memory_order_acquire))
+    {
+        ring = this->getLocalRing();
+    }
+    if (ring == nullptr)
+    {
+        // The writer has been stopped or the thread is terminating.
+        this->write(std::vector<LogEntry>{std::move(entry)});
+        return;
+    }
+    if (ring->push(entry))
+    {
+        // Wake up the writer before the ring fills up.
+        if (ring->size() == (ring->capacity() / 2))
+        {
+            wakeUp.notify_one();
+        }
+        return;
+    }
+    // Never block the producer, drop the entry and let the writer catch up.
+    dropped.fetch_add(1, std::memory_order_relaxed);
+    wakeUp.notify_one();
+}
+
+void LogBackend::flush()
+{
+    if (!running.load(std::memory_order_acquire))
+    {
+        return;
+    }
+    std::unique_lock<std::mutex> lock(writerMutex);
+    auto target = ++flushRequested;
+    wakeUp.notify_one();
+    flushed.wait(lock, [&]()
+    {
+        return (flushCompleted >= target) || stopping;
+    });
+}
+
+void LogBackend::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(writerMutex);
+        if (stopping)
+        {
+            return;
+        }
+        stopping = true;
+    }
+    wakeUp.notify_one();
+    if (writer.joinable())
+    {
+        writer.join();
+    }
+    running.store(false, std::memory_order_release);
+    // Write the entries which may have been logged while the writer was
+    // performing its last pass.
+    std::vector<LogEntry> batch;
+    this->drain(batch);
+    this->write(batch);
+    flushed.notify_all();
+}
+
+unsigned long LogBackend::getDropped() const
+{
+    return dropped.load(std::memory_order_relaxed);
+}
+
+LogRing * LogBackend::getLocalRing()
+{
+    static thread_local LocalRingHolder holder;
+    if (localRing == nullptr)
+    {
+        holder.ring = std::make_shared<LogRing>(ringCapacity);
+        {
+            std::lock_guard<std::mutex> lock(ringsMutex);
+            rings.emplace_back(holder.ring);
+        }
+        localRing = holder.ring.get();
+    }
+    else if (localRing == &holder)
+    {
+        return nullptr;
+    }
+    return static_cast<LogRing *>(localRing);
+}
+
+void LogBackend::writerLoop()
+{
+    std::vector<LogEntry> batch;
+    std::unique_lock<std::mutex> lock(writerMutex);
+    while (true)
+    {
+        // Wait for a flush request, otherwise collect the entries in batches.
+        wakeUp.wait_for(lock, std::chrono::milliseconds(50), [&]()
+        {
+            return stopping || (flushRequested != flushCompleted);
+        });
+        auto target = flushRequested;
+        auto terminate = stopping;
+        lock.unlock();
+        this->drain(batch);
+        this->write(batch);
+        batch.clear();
+        lock.lock();
+        flushCompleted = target;
+        flushed.notify_all();
+        if (terminate)
+        {
+            break;
+        }
+    }
+}
+
+void LogBackend::drain(std::vector<LogEntry> & batch)
+{
+    std::lock_guard<std::mutex> lock(ringsMutex);
+    auto it = rings.begin();
+    while (it != rings.end())
+    {
+        // Everything pushed before the ring has been closed is visible.
+        auto isClosed = (*it)->closed.load(std::memory_order_acquire);
+        LogEntry entry;
+        while ((*it)->pop(entry))
+        {
+            batch.emplace_back(std::move(entry));
+        }
+        if (isClosed)
+        {
+            it = rings.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+    auto lost = dropped.load(std::memory_order_relaxed);
+    if (lost != reportedDrops)
+    {
+        batch.emplace_back(LogEntry{
+            sequence.fetch_add(1, std::memory_order_relaxed),
+            LogLevel::Warning,
+            std::this_thread::get_id(),
+            time(nullptr),
+            "The log was full, " + std::to_string(lost - reportedDrops) +
+            " messages have been dropped."
+        });
+        reportedDrops = lost;
+    }
+    std::sort(batch.begin(), batch.end(),
+              [](const LogEntry & a, const LogEntry & b)
+              {
+                  return a.sequence < b.sequence;
+              });
+}
+
+void LogBackend::write(const std::vector<LogEntry> & batch)
+{
+    if (batch.empty())
+    {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(streamMutex);
+    std::string file, out, err;
+    for (auto const & entry : batch)
+    {
+        auto line = LogBackend::format(entry);
+        if (&Logger::getOutputStream(entry.level) == &std::cerr)
+        {
+            err.append(line);
+        }
+        else
+        {
+            out.append(line);
+        }
+        std::streamoff offset = -1;
+        if (stream.is_open())
+        {
+            offset = fileSize + static_cast<std::streamoff>(file.size());
+        }
+        index.add(entry.time, entry.level, line, offset);
+        file.append(line);
+    }
+    if (stream.is_open())
+    {
+        stream << file;
+        stream.flush();
+        fileSize += static_cast<std::streamoff>(file.size());
+    }
+    if (!out.empty())
+    {
+        std::cout << out;
+        std::cout.flush();
+    }
+    if (!err.empty())
+    {
+        std::cerr << err;
+    }
+}
+
+std::string LogBackend::format(const LogEntry & entry)
+{
+    char timestamp[32];
+    struct tm local;
+    localtime_r(&entry.time, &local);
+    strftime(timestamp, 32, "%H:%M:%S", &local);
+    std::stringstream line;
+    line << "[" << std::hex << entry.thread << std::dec << "]"
+         << "[" << Logger::levelToString(entry.level) << "]"
+         << "[" << timestamp << "] "
+         << entry.message << "\n";
+    return line.str();
+}
@@ -0,0 +1,356 @@
+/// @file   logIndex.cpp
+/// @brief  Implement the index used to search the log.
+/// @author Enrico Fraccaroli
+/// @date   Oct 19 2026
+/// @copyright
+/// Copyright (c) 2016 Enrico Fraccaroli <enrico.fraccaroli@gmail.com>
+/// Permission to use, copy, modify, and distribute this software for any
+/// purpose with or without fee is hereby granted, provided that the above
+/// copyright notice and this permission notice appear in all copies.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+/// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+/// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+/// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+/// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+/// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+/// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#include "utilities/logIndex.hpp"
+#include "utilities/logger.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <limits>
+#include <sstream>
+
+/// @brief Extracts the level from a line of the log.
+/// @return The mask of the level, zero if the line has no level.
+static unsigned int ParseLevel(const std::string & line)
+{
+    if (line.empty() || (line[0] != '['))
+    {
+        return 0;
+    }
+    auto start = line.find("][");
+    if (start == std::string::npos)
+    {
+        return 0;
+    }
+    for (unsigned int flag = 1; flag <= 64; flag <<= 1)
+    {
+        auto name = Logger::levelToString(static_cast<LogLevel>(flag));
+        if (line.compare(start + 2, name.size(), name) == 0)
+        {
+            return flag;
+        }
+    }
+    return 0;
+}
+
+/// @brief Extracts the time of the day from a line of the log.
+/// @return The seconds since midnight, -1 if the line has no time.
+static int ParseSeconds(const std::string & line)
+{
+    // The time follows the thread and the level: "[t][LEVEL][HH:MM:SS] ".
+    auto start = line.find("][");
+    if (start != std::string::npos)
+    {
+        start = line.find("][", start + 2);
+    }
+    if ((start == std::string::npos) || ((start + 10) > line.size()))
+    {
+        return -1;
+    }
+    int hours, minutes, seconds;
+    if (sscanf(line.c_str() + start + 2, "%2d:%2d:%2d",
+               &hours, &minutes, &seconds) != 3)
+    {
+        return -1;
+    }
+    return (hours * 3600) + (minutes * 60) + seconds;
+}
+
+LogIndex::LogIndex() :
+    indexMutex(),
+    logFilename(),
+    indexFilename(),
+    records(),
+    byLevel(),
+    segments(),
+    current(),
+    currentSize(),
+    nextNumber(1)
+{
+    // Nothing to do.
+}
+
+void LogIndex::open(const std::string & filename, const std::streamoff & size)
+{
+    std::lock_guard<std::mutex> lock(indexMutex);
+    logFilename = filename;
+    indexFilename = filename + ".idx";
+    segments.clear();
+    // Load the segments written by the previous runs.
+    std::ifstream index(indexFilename);
+    LogSegment segment{};
+    while (index >> segment.offset >> segment.length >> segment.firstTime
+                 >> segment.lastTime >> segment.levels)
+    {
+        if ((segment.offset + segment.length) > size)
+        {
+            break;
+        }
+        segment.firstNumber = 0;
+        segment.lastNumber = 0;
+        segments.emplace_back(segment);
+    }
+    index.close();
+    // Index the part of the log which has been written without an index,
+    // e.g. after a crash. The times of those lines are unknown.
+    std::streamoff end = 0;
+    if (!segments.empty())
+    {
+        end = segments.back().offset + segments.back().length;
+    }
+    if (end < size)
+    {
+        std::ifstream log(filename);
+        log.seekg(end, std::ios::beg);
+        LogSegment gap{end, 0, 0, std::numeric_limits<time_t>::max(), 0, 0, 0};
+        size_t lines = 0;
+        for (std::string line; std::getline(log, line);)
+        {
+            gap.length += static_cast<std::streamoff>(line.size() + 1);
+            gap.levels |= ParseLevel(line);
+            if ((++lines == segmentCapacity) ||
+                ((gap.offset + gap.length) >= size))
+            {
+                current = gap;
+                this->closeSegment();
+                gap = LogSegment{gap.offset + gap.length, 0, 0,
+                                 std::numeric_limits<time_t>::max(), 0, 0, 0};
+                lines = 0;
+            }
+        }
+    }
+    current = LogSegment{};
+    currentSize = 0;
+}
+
+void LogIndex::add(const time_t & time,
+                   const LogLevel_t & level,
+                   const std::string & line,
+                   const std::streamoff & offset)
+{
+    std::lock_guard<std::mutex> lock(indexMutex);
+    auto number = nextNumber++;
+    records.emplace_back(LogRecord{number, time, level, line});
+    byLevel[LogIndex::levelToIndex(level)].emplace_back(number);
+    if (offset >= 0)
+    {
+        if (currentSize == 0)
+        {
+            current = LogSegment{offset, 0, time, time, 0, number, 0};
+        }
+        current.length = offset + static_cast<std::streamoff>(line.size()) -
+                         current.offset;
+        current.lastTime = time;
+        current.levels |= static_cast<unsigned int>(level);
+        current.lastNumber = number;
+        if (++currentSize == segmentCapacity)
+        {
+            this->closeSegment();
+        }
+    }
+    this->evictRecords();
+}
+
+bool LogIndex::search(const LogLevel_t & level,
+                      const time_t & since,
+                      const size_t & maxLines,
+                      std::string * result) const
+{
+    result->clear();
+    std::vector<std::string> lines;
+    // The segments to read, with the number of their records to read.
+    std::vector<std::pair<LogSegment, size_t>> older;
+    {
+        std::lock_guard<std::mutex> lock(indexMutex);
+        // Search the records in memory, from the most recent.
+        auto const & numbers = byLevel[LogIndex::levelToIndex(level)];
+        for (auto it = numbers.rbegin(); it != numbers.rend(); ++it)
+        {
+            auto const & record = records[*it - records.front().number];
+            if ((lines.size() == maxLines) || (record.time < since))
+            {
+                break;
+            }
+            lines.emplace_back(record.line);
+        }
+        std::reverse(lines.begin(), lines.end());
+        // Collect the segments with records older than the ones in memory,
+        // including the one which is being written.
+        auto oldest = records.empty() ? nextNumber : records.front().number;
+        auto flag = static_cast<unsigned int>(level);
+        auto collect = [&](const LogSegment & segment)
+        {
+            // The time of the segments indexed after a crash is unknown.
+            if ((segment.firstNumber >= oldest) ||
+                ((segment.levels & flag) == 0) ||
+                (segment.lastTime < since) ||
+                ((since > 0) && (segment.firstTime == 0)))
+            {
+                return;
+            }
+            auto limit = std::numeric_limits<size_t>::max();
+            if (segment.lastNumber >= oldest)
+            {
+                limit = oldest - segment.firstNumber;
+            }
+            older.emplace_back(segment, limit);
+        };
+        for (auto const & segment : segments)
+        {
+            collect(segment);
+        }
+        if (currentSize != 0)
+        {
+            collect(current);
+        }
+    }
+    // Read the segments from the most recent, without holding the lock.
+    if ((lines.size() < maxLines) && !older.empty())
+    {
+        std::ifstream file(logFilename);
+        if (file.is_open())
+        {
+            std::string levelTag = "][" + Logger::levelToString(level) + "][";
+            for (auto it = older.rbegin(); it != older.rend(); ++it)
+            {
+                if (lines.size() >= maxLines)
+                {
+                    break;
+                }
+                std::vector<std::string> found;
+                LogIndex::readSegment(file, it->first, levelTag, since,
+                                      it->second, found);
+                // Keep only the most recent lines, a segment can hold many
+                // more lines than the ones still missing.
+                auto missing = maxLines - lines.size();
+                auto skip = (found.size() > missing) ?
+                            (found.size() - missing) : 0;
+                lines.insert(lines.begin(),
+                             found.begin() + static_cast<std::ptrdiff_t>(skip),
+                             found.end());
+            }
+        }
+    }
+    // Keep only the most recent lines.
+    auto first = (lines.size() > maxLines) ? (lines.size() - maxLines) : 0;
+    for (auto it = first; it < lines.size(); ++it)
+    {
+        result->append(lines[it]);
+    }
+    return true;
+}
+
+size_t LogIndex::levelToIndex(const LogLevel_t & level)
+{
+    size_t index = 0;
+    for (auto flag = static_cast<unsigned int>(level); flag > 1; flag >>= 1)
+    {
+        ++index;
+    }
+    return std::min(index, numLevels - 1);
+}
+
+void LogIndex::closeSegment()
+{
+    segments.emplace_back(current);
+    std::ofstream index(indexFilename, std::ios::out | std::ios::app);
+    if (index.is_open())
+    {
+        index << current.offset << " " << current.length << " "
+              << current.firstTime << " " << current.lastTime << " "
+              << current.levels << "\n";
+    }
+    current = LogSegment{};
+    currentSize = 0;
+}
+
+void LogIndex::evictRecords()
+{
+    while (records.size() > memoryCapacity)
+    {
+        auto const & record = records.front();
+        auto & numbers = byLevel[LogIndex::levelToIndex(record.level)];
+        if (!numbers.empty() && (numbers.front() == record.number))
+        {
+            numbers.pop_front();
+        }
+        records.pop_front();
+    }
+}
+
+void LogIndex::readSegment(std::ifstream & file,
+                           const LogSegment & segment,
+                           const std::string & levelTag,
+                           const time_t & since,
+                           const size_t & limit,
+                           std::vector<std::string> & lines)
+{
+    std::string buffer(static_cast<size_t>(segment.length), '\0');
+    file.clear();
+    file.seekg(segment.offset, std::ios::beg);
+    file.read(&buffer[0], segment.length);
+    buffer.resize(static_cast<size_t>(file.gcount()));
+    std::istringstream stream(buffer);
+    // The lines only carry the time of the day, the date is taken from the
+    // first record of the segment and moved to the next day every time the
+    // clock goes back.
+    struct tm day{};
+    localtime_r(&segment.firstTime, &day);
+    int previous = -1;
+    size_t records = 0;
+    bool matching = false;
+    for (std::string line; std::getline(stream, line);)
+    {
+        if (!line.empty() && (line[0] == '['))
+        {
+            if (records++ == limit)
+            {
+                break;
+            }
+            auto position = line.find(levelTag);
+            matching = (position != std::string::npos) && (position < 32);
+            int seconds = -1;
+            if (since > 0)
+            {
+                seconds = ParseSeconds(line);
+            }
+            if (seconds >= 0)
+            {
+                if (seconds < previous)
+                {
+                    ++day.tm_mday;
+                }
+                previous = seconds;
+                if (matching)
+                {
+                    struct tm local = day;
+                    local.tm_hour = seconds / 3600;
+                    local.tm_min = (seconds / 60) % 60;
+                    local.tm_sec = seconds % 60;
+                    local.tm_isdst = -1;
+                    matching = (mktime(&local) >= since);
+                }
+            }
+        }
+        // The lines which do not begin a record belong to the previous one.
+        if (matching)
+        {
+            lines.emplace_back(line + "\n");
+        }
+    }
+}
@@ -17,10 +17,7 @@
 /// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 
 #include "utilities/logger.hpp"
-#include "utilities/utils.hpp"
-
-#include <thread>
-#include <mutex>
+#include "utilities/logBackend.hpp"
 
 Logger::Logger()
 {
@@ -43,41 +40,16 @@ Logger & Logger::instance()
 
 bool Logger::openLog(const std::string & filename)
 {
-    if (!Logger::getStream().is_open())
-    {
-        Logger::getStream().open(filename.c_str(), std::ios::in |
-                                                   std::ios::out |
-                                                   std::ios::app);
-    }
-    return Logger::getStream().is_open();
+    return LogBackend::instance().open(filename);
 }
 
-bool Logger::getLog(const LogLevel & level, std::string * result)
+bool Logger::getLog(const LogLevel & level,
+                    std::string * result,
+                    const size_t & maxLines,
+                    const time_t & since)
 {
-    if (Logger::getStream().is_open())
-    {
-        // Clear the output string.
-        result->clear();
-        std::streamoff totalSize = Logger::getStream().tellg();
-        if (totalSize > 0)
-        {
-            // Resize the log string.
-            result->resize(static_cast<std::size_t>(totalSize));
-            // Move the input position to the beginning of the string.
-            Logger::getStream().seekg(0, std::ios::beg);
-            // Create a string which contains the given level.
-            std::string logLevel = "[" + Logger::levelToString(level) + "]";
-            for (std::string line; std::getline(Logger::getStream(), line);)
-            {
-                if (BeginWith(line, logLevel))
-                {
-                    result->append(line + "\n");
-                }
-            }
-            return true;
-        }
-    }
-    return false;
+    return LogBackend::instance().getIndex().search(level, since, maxLines,
+                                                    result);
 }
 
 LogLevel Logger::castFromInt(const unsigned int & level)
@@ -85,40 +57,42 @@ LogLevel Logger::castFromInt(const unsigned int & level)
     return static_cast<LogLevel>(level);
 }
 
-void Logger::log(const LogLevel & level, const std::string & msg)
+void Logger::setLevelEnabled(const LogLevel & level, const bool & enabled)
 {
-    // Define a mutex for the log function.
-    static std::mutex logMutex;
-    std::lock_guard<std::mutex> lock(logMutex);
-    if (Logger::getStream().is_open())
-    {
-        // Write the log message inside the file.
-        Logger::getStream()
-            << "[" << std::hex << std::this_thread::get_id() << std::dec << "]"
-            << "[" << Logger::levelToString(level) << "]"
-            << "[" << Logger::getDateTime() << "] "
-            << msg << "\n";
-    }
-    Logger::getOutputStream(level)
-        << "[" << std::hex << std::this_thread::get_id() << std::dec << "]"
-        << "[" << Logger::levelToString(level) << "]"
-        << "[" << Logger::getDateTime() << "] "
-        << msg << "\n";
+    auto flag = static_cast<unsigned int>(level);
+    if (enabled)
+    {
+        Logger::getEnabledLevels().fetch_or(flag);
+    }
+    else
+    {
+        Logger::getEnabledLevels().fetch_and(~flag);
+    }
 }
 
-std::fstream & Logger::getStream()
+unsigned long Logger::getDroppedCount()
 {
-    static std::fstream out_stream;
-    return out_stream;
+    return LogBackend::instance().getDropped();
+}
+
+void Logger::flush()
+{
+    LogBackend::instance().flush();
+}
+
+void Logger::log(const LogLevel & level, const std::string & msg)
+{
+    if (Logger::isEnabled(level))
+    {
+        LogBackend::instance().push(level, msg);
+    }
 }
 
-std::string Logger::getDateTime()
+std::atomic<unsigned int> & Logger::getEnabledLevels()
 {
-    time_t now = time(nullptr);
-    char buffer[32];
-    // Format: H:M
-    strftime(buffer, 32, "%H:%M:%S", localtime(&now));
-    return std::string(buffer);
+    // All the levels are enabled by default.
+    static std::atomic<unsigned int> enabledLevels(~0u);
+    return enabledLevels;
 }
 
 std::ostream & Logger::getOutputStream(const LogLevel & level)
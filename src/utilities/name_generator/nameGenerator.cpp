@@ -6,436 +6,388 @@
 #include "utilities/name_generator/nameGenerator.hpp"
 #include "utilities/utils.hpp"
 
-#include <memory>
+#include <algorithm>
+#include <mutex>
+#include <stdexcept>
 
 namespace namegen
 {
 
 // -----------------------------------------------------------------------------
-// NAME GENERATOR
+// COMPILED PATTERN
 
-NameGenerator::NameGenerator()
+/// Provides how many times in a row a letter can appear, once collapsed.
+static int CollapseLimit(char ch)
 {
-    // Nothing to do.
+    switch (ch)
+    {
+        case 'a':
+        case 'h':
+        case 'i':
+        case 'j':
+        case 'q':
+        case 'u':
+        case 'v':
+        case 'w':
+        case 'x':
+        case 'y':
+            return 1;
+        default:
+            return 2;
+    }
 }
 
-NameGenerator::NameGenerator(const std::string & pattern, bool collapse_triples)
+CompiledPattern::CompiledPattern(const std::string & pattern,
+                                 bool collapse_triples) :
+    nodes(),
+    children(),
+    literals(),
+    total(),
+    longest()
 {
-    std::unique_ptr<NameGenerator> last;
-
-    std::stack<std::unique_ptr<Group>> stack;
-    std::unique_ptr<Group> top = std::make_unique<GroupSymbol>();
+    /// A group of the pattern, made of alternative sequences of nodes.
+    struct Group
+    {
+        /// If the letters of the group are symbols.
+        bool symbol;
+        /// The alternative sequences.
+        std::vector<std::vector<unsigned int>> set;
+        /// The manipulators to apply to the next node.
+        std::vector<Operation> manipulators;
+    };
+    // The nodes of the symbols are shared by all their occurrences.
+    std::unordered_map<char, unsigned int> symbolNodes;
+    static const auto & symbols = CompiledPattern::getSymbolMap();
+
+    auto add = [this](Group & group, unsigned int node)
+    {
+        while (!group.manipulators.empty())
+        {
+            node = this->addManipulator(group.manipulators.back(), node);
+            group.manipulators.pop_back();
+        }
+        if (group.set.empty())
+        {
+            group.set.emplace_back();
+        }
+        group.set.back().emplace_back(node);
+    };
+    auto addCharacter = [&](Group & group, char c)
+    {
+        if (!group.symbol)
+        {
+            add(group, this->addLiteral(std::string(1, c)));
+            return;
+        }
+        auto symbolNode = symbolNodes.find(c);
+        if (symbolNode == symbolNodes.end())
+        {
+            auto symbol = symbols.find(std::string(1, c));
+            if (symbol == symbols.end())
+            {
+                add(group, this->addLiteral(std::string(1, c)));
+                return;
+            }
+            std::vector<unsigned int> choices;
+            for (auto const & value : symbol->second)
+            {
+                choices.emplace_back(this->addLiteral(value));
+            }
+            symbolNode = symbolNodes.emplace(
+                c, this->addList(Operation::Random, choices)).first;
+        }
+        add(group, symbolNode->second);
+    };
+    auto emitGroup = [this](Group & group)
+    {
+        if (group.set.empty())
+        {
+            return this->addLiteral("");
+        }
+        std::vector<unsigned int> choices;
+        for (auto const & sequence : group.set)
+        {
+            choices.emplace_back((sequence.size() == 1) ? sequence.front() :
+                                 this->addList(Operation::Sequence,
+                                               sequence));
+        }
+        return (choices.size() == 1) ? choices.front() :
+               this->addList(Operation::Random, choices);
+    };
 
+    std::vector<Group> stack;
+    stack.emplace_back(Group{true, {}, {}});
     for (auto c : pattern)
     {
+        auto & top = stack.back();
         switch (c)
         {
             case '<':
-                stack.push(std::move(top));
-                top = std::make_unique<GroupSymbol>();
+                stack.emplace_back(Group{true, {}, {}});
                 break;
             case '(':
-                stack.push(std::move(top));
-                top = std::make_unique<GroupLiteral>();
+                stack.emplace_back(Group{false, {}, {}});
                 break;
             case '>':
             case ')':
-                if (stack.empty())
+            {
+                if (stack.size() == 1)
                 {
                     throw std::invalid_argument("Unbalanced brackets");
                 }
-                else if (c == '>' && top->groupType != GroupType::Symbol)
+                else if (c == '>' && !top.symbol)
                 {
                     throw std::invalid_argument("Unexpected '>' in pattern");
                 }
-                else if (c == ')' && top->groupType != GroupType::Literal)
+                else if (c == ')' && top.symbol)
                 {
                     throw std::invalid_argument("Unexpected ')' in pattern");
                 }
-                last = top->emit();
-                top = std::move(stack.top());
-                stack.pop();
-                top->add(std::move(last));
+                auto last = emitGroup(top);
+                stack.pop_back();
+                add(stack.back(), last);
                 break;
+            }
             case '|':
-                top->split();
-                break;
-            case '!':
-                if (top->groupType == GroupType::Symbol)
-                {
-                    top->wrap(Manipulator::Capitalize);
-                }
-                else
+                if (top.set.empty())
                 {
-                    top->add(c);
+                    top.set.emplace_back();
                 }
+                top.set.emplace_back();
                 break;
+            case '!':
             case '~':
-                if (top->groupType == GroupType::Symbol)
+                if (top.symbol)
                 {
-                    top->wrap(Manipulator::Reverse);
+                    top.manipulators.emplace_back(
+                        (c == '!') ? Operation::Capitalize :
+                        Operation::Reverse);
                 }
                 else
                 {
-                    top->add(c);
+                    addCharacter(top, c);
                 }
                 break;
             default:
-                top->add(c);
+                addCharacter(top, c);
                 break;
         }
     }
-
-    if (stack.size() != 0)
+    if (stack.size() != 1)
     {
         throw std::invalid_argument("Missing closing bracket");
     }
-
-    std::unique_ptr<NameGenerator> g = top->emit();
+    auto root = emitGroup(stack.back());
     if (collapse_triples)
     {
-        g = std::make_unique<Collapser>(std::move(g));
+        root = this->addManipulator(Operation::Collapse, root);
     }
-    add(std::move(g));
-}
-
-NameGenerator::NameGenerator(
-    std::vector<std::unique_ptr<NameGenerator>> && _generators) :
-    generators(std::move(_generators))
-{
+    this->measure(root, total, longest);
 }
 
-size_t NameGenerator::combinations()
+std::shared_ptr<const CompiledPattern> CompiledPattern::get(
+    const std::string & pattern)
 {
-    size_t total = 1;
-    for (auto & g : generators)
+    static std::mutex cacheMutex;
+    static std::unordered_map<std::string,
+                              std::shared_ptr<const CompiledPattern>> cache;
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    auto it = cache.find(pattern);
+    if (it != cache.end())
     {
-        total *= g->combinations();
+        return it->second;
     }
-    return total;
-}
-
-size_t NameGenerator::min()
-{
-    size_t final = 0;
-    for (auto & g : generators)
-    {
-        final += g->min();
-    }
-    return final;
-}
-
-size_t NameGenerator::max()
-{
-    size_t final = 0;
-    for (auto & g : generators)
-    {
-        final += g->max();
-    }
-    return final;
-}
-
-std::string NameGenerator::toString()
-{
-    std::string str;
-    for (auto & g : generators)
+    auto compiled = std::make_shared<const CompiledPattern>(pattern);
+    // The patterns can come from the players, keep the cache bounded.
+    if (cache.size() >= MaxCachedPatterns)
     {
-        str.append(g->toString());
+        cache.clear();
     }
-    return str;
+    cache.emplace(pattern, compiled);
+    return compiled;
 }
 
-void NameGenerator::add(std::unique_ptr<NameGenerator> && g)
+size_t CompiledPattern::combinations() const
 {
-    generators.emplace_back(std::move(g));
+    return total;
 }
 
-// -----------------------------------------------------------------------------
-// GROUP
-
-NameGenerator::Group::Group(const GroupType & _groupType) :
-    groupType(_groupType)
+void CompiledPattern::generate(std::string & buffer) const
 {
-    // Nothing to do.
+    this->emit(static_cast<unsigned int>(nodes.size() - 1), buffer);
 }
 
-std::unique_ptr<NameGenerator> NameGenerator::Group::emit()
+void CompiledPattern::generate(std::string & buffer,
+                               size_t amount,
+                               char separator) const
 {
-    switch (set.size())
+    buffer.reserve(buffer.size() + amount * (longest + 1));
+    for (size_t it = 0; it < amount; ++it)
     {
-        case 0:
-            return std::make_unique<Literal>("");
-        case 1:
-            return std::move(*set.begin());
-        default:
-            return std::make_unique<Random>(std::move(set));
+        this->generate(buffer);
+        buffer.push_back(separator);
     }
 }
 
-void NameGenerator::Group::split()
+std::vector<std::string> CompiledPattern::generateUnique(
+    size_t amount,
+    std::unordered_set<std::string> & taken,
+    size_t attempts) const
 {
-    if (set.empty())
+    std::vector<std::string> names;
+    std::string name;
+    for (size_t it = 0; (it < attempts) && (names.size() < amount); ++it)
     {
-        set.push_back(std::make_unique<Sequence>());
-    }
-    set.push_back(std::make_unique<Sequence>());
-}
-
-void NameGenerator::Group::wrap(const Manipulator & manipulator)
-{
-    manipulators.push(manipulator);
-}
-
-void NameGenerator::Group::add(std::unique_ptr<NameGenerator> && g)
-{
-    while (!manipulators.empty())
-    {
-        if (manipulators.top() == Manipulator::Reverse)
-        {
-            g = std::make_unique<Reverser>(std::move(g));
-        }
-        else if (manipulators.top() == Manipulator::Capitalize)
+        name.clear();
+        this->generate(name);
+        if (!name.empty() && taken.insert(ToLower(name)).second)
         {
-            g = std::make_unique<Capitalizer>(std::move(g));
+            names.emplace_back(name);
         }
-        manipulators.pop();
     }
-    if (set.empty())
-    {
-        set.push_back(std::make_unique<Sequence>());
-    }
-    set.back()->add(std::move(g));
+    return names;
 }
 
-void NameGenerator::Group::add(char c)
+std::string CompiledPattern::toString() const
 {
-    std::unique_ptr<NameGenerator> g = std::make_unique<Random>();
-    g->add(std::make_unique<Literal>(std::string(1, c)));
-    Group::add(std::move(g));
+    std::string name;
+    this->generate(name);
+    return name;
 }
 
-// -----------------------------------------------------------------------------
-// GROUP SYMBOL
-
-NameGenerator::GroupSymbol::GroupSymbol() :
-    Group(GroupType::Symbol)
+unsigned int CompiledPattern::addLiteral(const std::string & value)
 {
-    // Nothing to do.
+    nodes.emplace_back(Node{Operation::Literal,
+                            static_cast<unsigned int>(literals.size()),
+                            static_cast<unsigned int>(value.size())});
+    literals.append(value);
+    return static_cast<unsigned int>(nodes.size() - 1);
 }
 
-void NameGenerator::GroupSymbol::add(char c)
+unsigned int CompiledPattern::addList(Operation operation,
+                                      const std::vector<unsigned int> & list)
 {
-    // Transform the character into a string.
-    std::string value(1, c);
-    // Create a new
-    auto g = std::make_unique<Random>();
-    try
-    {
-        static const auto & symbols = NameGenerator::getSymbolMap();
-        for (const auto & s : symbols.at(value))
-        {
-            g->add(std::make_unique<Literal>(s));
-        }
-    } catch (const std::out_of_range &)
-    {
-        g->add(std::make_unique<Literal>(value));
-    }
-    Group::add(std::move(g));
+    nodes.emplace_back(Node{operation,
+                            static_cast<unsigned int>(children.size()),
+                            static_cast<unsigned int>(list.size())});
+    children.insert(children.end(), list.begin(), list.end());
+    return static_cast<unsigned int>(nodes.size() - 1);
 }
 
-// -----------------------------------------------------------------------------
-// GROUP LITERAL
-
-NameGenerator::GroupLiteral::GroupLiteral() :
-    Group(GroupType::Literal)
+unsigned int CompiledPattern::addManipulator(Operation operation,
+                                             unsigned int child)
 {
-    // Nothing to do.
+    nodes.emplace_back(Node{operation, child, 1});
+    return static_cast<unsigned int>(nodes.size() - 1);
 }
 
-// -----------------------------------------------------------------------------
-// RANDOM
-
-Random::Random()
+void CompiledPattern::measure(unsigned int node,
+                              size_t & combinations,
+                              size_t & length) const
 {
-    // Nothing to do.
-}
-
-Random::Random(std::vector<std::unique_ptr<NameGenerator>> && generators_) :
-    NameGenerator(std::move(generators_))
-{
-    // Nothing to do.
-}
-
-size_t Random::combinations()
-{
-    size_t total = 0;
-    for (auto & g : generators)
+    auto const & current = nodes[node];
+    combinations = 1;
+    length = 0;
+    if (current.operation == Operation::Literal)
     {
-        total += g->combinations();
+        length = current.count;
     }
-    return total ? total : 1;
-}
-
-size_t Random::min()
-{
-    size_t final = 0;
-    for (auto & g : generators)
+    else if (current.operation == Operation::Sequence)
     {
-        size_t current = g->min();
-        if (current < final)
+        for (unsigned int it = 0; it < current.count; ++it)
         {
-            final = current;
+            size_t childCombinations, childLength;
+            this->measure(children[current.first + it],
+                          childCombinations, childLength);
+            combinations *= childCombinations;
+            length += childLength;
         }
     }
-    return final;
-}
-
-size_t Random::max()
-{
-    size_t final = 0;
-    for (auto & g : generators)
+    else if (current.operation == Operation::Random)
     {
-        size_t current = g->max();
-        if (current > final)
+        combinations = 0;
+        for (unsigned int it = 0; it < current.count; ++it)
+        {
+            size_t childCombinations, childLength;
+            this->measure(children[current.first + it],
+                          childCombinations, childLength);
+            combinations += childCombinations;
+            length = std::max(length, childLength);
+        }
+        if (combinations == 0)
         {
-            final = current;
+            combinations = 1;
         }
     }
-    return final;
-}
-
-std::string Random::toString()
-{
-    if (!generators.size())
+    else
     {
-        return "";
+        this->measure(current.first, combinations, length);
     }
-    return generators[TRand<size_t>(0, generators.size() - 1)]->toString();
-}
-
-// -----------------------------------------------------------------------------
-// SEQUENCE
-
-Sequence::Sequence()
-{
-    // Nothing to do.
-}
-
-Sequence::Sequence(std::vector<std::unique_ptr<NameGenerator>> && generators_) :
-    NameGenerator(std::move(generators_))
-{
-    // Nothing to do.
-}
-
-// -----------------------------------------------------------------------------
-// LITERAL
-
-Literal::Literal(const std::string & value_) :
-    value(value_)
-{
-    // Nothing to do.
-}
-
-size_t Literal::combinations()
-{
-    return 1;
-}
-
-size_t Literal::min()
-{
-    return value.size();
-}
-
-size_t Literal::max()
-{
-    return value.size();
-}
-
-std::string Literal::toString()
-{
-    return value;
-}
-
-// -----------------------------------------------------------------------------
-// REVERSER
-
-Reverser::Reverser(std::unique_ptr<NameGenerator> && g)
-{
-    this->add(std::move(g));
-}
-
-std::string Reverser::toString()
-{
-    auto str(NameGenerator::toString());
-    std::reverse(str.begin(), str.end());
-    return str;
 }
 
-// -----------------------------------------------------------------------------
-// CAPITALIZER
-
-Capitalizer::Capitalizer(std::unique_ptr<NameGenerator> && g)
-{
-    this->add(std::move(g));
-}
-
-std::string Capitalizer::toString()
-{
-    auto str(NameGenerator::toString());
-    str[0] = static_cast<char>(std::toupper(str[0]));
-    return str;
-}
-
-// -----------------------------------------------------------------------------
-// COLLAPSER
-
-Collapser::Collapser(std::unique_ptr<NameGenerator> && g)
+void CompiledPattern::emit(unsigned int node, std::string & buffer) const
 {
-    this->add(std::move(g));
-}
-
-std::string Collapser::toString()
-{
-    // Prepare a variable for the output string.
-    std::string out;
-    // Prepare a counter variable.
-    int counter = 0;
-    char pch = '\0';
-    for (char ch : NameGenerator::toString())
+    auto const & current = nodes[node];
+    auto start = buffer.size();
+    switch (current.operation)
     {
-        int mch;
-        switch (ch)
-        {
-            case 'a':
-            case 'h':
-            case 'i':
-            case 'j':
-            case 'q':
-            case 'u':
-            case 'v':
-            case 'w':
-            case 'x':
-            case 'y':
-                mch = 1;
-                break;
-            default:
-                mch = 2;
-                break;
-        }
-        if (ch == pch) ++counter;
-        else counter = 0;
-        if (counter < mch)
+        case Operation::Literal:
+            buffer.append(literals, current.first, current.count);
+            break;
+        case Operation::Sequence:
+            for (unsigned int it = 0; it < current.count; ++it)
+            {
+                this->emit(children[current.first + it], buffer);
+            }
+            break;
+        case Operation::Random:
+            if (current.count > 0)
+            {
+                auto choice = TRand<unsigned int>(0, current.count - 1);
+                this->emit(children[current.first + choice], buffer);
+            }
+            break;
+        case Operation::Capitalize:
+            this->emit(current.first, buffer);
+            if (buffer.size() > start)
+            {
+                buffer[start] = static_cast<char>(std::toupper(buffer[start]));
+            }
+            break;
+        case Operation::Reverse:
+            this->emit(current.first, buffer);
+            std::reverse(buffer.begin() + static_cast<long>(start),
+                         buffer.end());
+            break;
+        case Operation::Collapse:
         {
-            out.push_back(ch);
+            this->emit(current.first, buffer);
+            // Drop the letters repeated too many times, in place.
+            auto out = start;
+            int counter = 0;
+            char pch = '\0';
+            for (auto it = start; it < buffer.size(); ++it)
+            {
+                auto ch = buffer[it];
+                auto mch = CollapseLimit(ch);
+                if (ch == pch) ++counter;
+                else counter = 0;
+                if (counter < mch)
+                {
+                    buffer[out++] = ch;
+                }
+                pch = ch;
+            }
+            buffer.resize(out);
+            break;
         }
-        pch = ch;
     }
-    return out;
 }
 
+
 // https://isocpp.org/wiki/faq/ctors#static-init-order
 // Avoid the "static initialization order fiasco"
-const NameGenerator::SymbolMap & NameGenerator::getSymbolMap()
+const CompiledPattern::SymbolMap & CompiledPattern::getSymbolMap()
 {
     static auto * const symbols = new SymbolMap(
         {
@@ -0,0 +1,181 @@
+/// @file   random.cpp
+/// @brief  Implement the random number generators of the mud.
+/// @author Enrico Fraccaroli
+/// @date   Oct 19 2026
+/// @copyright
+/// Copyright (c) 2016 Enrico Fraccaroli <enrico.fraccaroli@gmail.com>
+/// Permission to use, copy, modify, and distribute this software for any
+/// purpose with or without fee is hereby granted, provided that the above
+/// copyright notice and this permission notice appear in all copies.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+/// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+/// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+/// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+/// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+/// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+/// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#include "utilities/random.hpp"
+#include "utilities/logger.hpp"
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <random>
+
+/// The number of records kept in memory.
+static const size_t maxRecords = 256;
+
+/// @brief Scrambles the given value, used to expand a seed.
+static uint64_t SplitMix(uint64_t & value)
+{
+    auto result = (value += 0x9E3779B97F4A7C15ULL);
+    result = (result ^ (result >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    result = (result ^ (result >> 27)) * 0x94D049BB133111EBULL;
+    return result ^ (result >> 31);
+}
+
+/// @brief Provides the master seed, initially picked from the system.
+static std::atomic<uint64_t> & GetMasterSeed()
+{
+    static std::atomic<uint64_t> masterSeed([]()
+    {
+        std::random_device randomDevice;
+        return (static_cast<uint64_t>(randomDevice()) << 32) ^ randomDevice();
+    }());
+    return masterSeed;
+}
+
+/// @brief Provides the order in which the threads have been seeded.
+static std::atomic<uint64_t> & GetThreadCounter()
+{
+    static std::atomic<uint64_t> threadCounter;
+    return threadCounter;
+}
+
+/// @brief Protects the records and the seeds to replay.
+static std::mutex & GetRecordsMutex()
+{
+    static std::mutex recordsMutex;
+    return recordsMutex;
+}
+
+/// @brief Provides the records of the seeds.
+static std::deque<RandomRecord> & GetRecords()
+{
+    static std::deque<RandomRecord> records;
+    return records;
+}
+
+/// @brief Provides the seeds to replay.
+static std::map<std::string, uint64_t> & GetReplays()
+{
+    static std::map<std::string, uint64_t> replays;
+    return replays;
+}
+
+Xoshiro256::Xoshiro256(const uint64_t & seed) :
+    state()
+{
+    this->seed(seed);
+}
+
+void Xoshiro256::seed(uint64_t seed)
+{
+    for (auto & it : state)
+    {
+        it = SplitMix(seed);
+    }
+}
+
+Xoshiro256 & Random::generator()
+{
+    static thread_local Xoshiro256 threadGenerator(
+        GetMasterSeed().load() ^
+        (GetThreadCounter().fetch_add(1) * 0xD1B54A32D192ED03ULL));
+    return threadGenerator;
+}
+
+void Random::seed(const uint64_t & seed)
+{
+    GetMasterSeed().store(seed);
+    GetThreadCounter().store(1);
+    Random::generator().seed(seed);
+    Logger::log(LogLevel::Info, "The master seed is now %s.", seed);
+}
+
+uint64_t Random::getSeed()
+{
+    return GetMasterSeed().load();
+}
+
+uint64_t Random::drawSeed(const std::string & label)
+{
+    {
+        std::lock_guard<std::mutex> lock(GetRecordsMutex());
+        auto it = GetReplays().find(label);
+        if (it != GetReplays().end())
+        {
+            auto seed = it->second;
+            GetReplays().erase(it);
+            return seed;
+        }
+    }
+    return Random::generator()();
+}
+
+void Random::setReplay(const std::string & label, const uint64_t & seed)
+{
+    std::lock_guard<std::mutex> lock(GetRecordsMutex());
+    GetReplays()[label] = seed;
+}
+
+void Random::record(const std::string & label, const uint64_t & seed)
+{
+    std::lock_guard<std::mutex> lock(GetRecordsMutex());
+    auto & records = GetRecords();
+    records.emplace_back(RandomRecord{label, seed, time(nullptr)});
+    if (records.size() > maxRecords)
+    {
+        records.pop_front();
+    }
+}
+
+std::deque<RandomRecord> Random::getRecords()
+{
+    std::lock_guard<std::mutex> lock(GetRecordsMutex());
+    return GetRecords();
+}
+
+RandomScope::RandomScope(const std::string & label) :
+    RandomScope(label, Random::drawSeed(label))
+{
+    // Nothing to do.
+}
+
+RandomScope::RandomScope(const std::string & label, const uint64_t & _seed) :
+    saved(Random::generator()),
+    seed(_seed),
+    source()
+{
+    Random::generator().seed(seed);
+    Random::record(label, seed);
+}
+
+RandomScope::RandomScope(Xoshiro256 & _source) :
+    saved(Random::generator()),
+    seed(),
+    source(&_source)
+{
+    Random::generator() = *source;
+}
+
+RandomScope::~RandomScope()
+{
+    if (source != nullptr)
+    {
+        *source = Random::generator();
+    }
+    Random::generator() = saved;
+}
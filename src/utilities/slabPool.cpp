@@ -0,0 +1,142 @@
+/// @file   slabPool.cpp
+/// @brief  Implements the pools used to allocate the items, rooms and mobiles.
+/// @author Enrico Fraccaroli
+/// @date   Oct 19 2026
+/// @copyright
+/// Copyright (c) 2016 Enrico Fraccaroli <enrico.fraccaroli@gmail.com>
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///     The above copyright notice and this permission notice shall be included
+///     in all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+
+
+#include "utilities/slabPool.hpp"
+
+#include <algorithm>
+#include <cstddef>
+
+SlabPool::SlabPool(std::string _family, size_t _objectSize) :
+    family(std::move(_family)),
+    objectSize(_objectSize),
+    slotSize(),
+    slabs(),
+    freeList(),
+    live(),
+    poolMutex()
+{
+    // Each slot must be able to hold the link to the next free slot and must
+    //  keep the alignment of the objects.
+    auto alignment = alignof(std::max_align_t);
+    slotSize = std::max(_objectSize, sizeof(void *));
+    slotSize = ((slotSize + alignment - 1) / alignment) * alignment;
+}
+
+void * SlabPool::allocate()
+{
+    std::lock_guard<std::mutex> lock(poolMutex);
+    if (freeList == nullptr)
+    {
+        this->addSlab();
+    }
+    auto slot = freeList;
+    freeList = *static_cast<void **>(slot);
+    ++live;
+    return slot;
+}
+
+void SlabPool::deallocate(void * slot)
+{
+    std::lock_guard<std::mutex> lock(poolMutex);
+    *static_cast<void **>(slot) = freeList;
+    freeList = slot;
+    --live;
+}
+
+SlabPoolStatistics SlabPool::getStatistics() const
+{
+    std::lock_guard<std::mutex> lock(poolMutex);
+    auto slots = slabs.size() * SlotsPerSlab;
+    return SlabPoolStatistics{family, objectSize, slotSize,
+                              live, slots - live, slabs.size()};
+}
+
+void SlabPool::addSlab()
+{
+    slabs.emplace_back(new char[slotSize * SlotsPerSlab]);
+    auto slab = slabs.back().get();
+    // Link the slots backward, so that they are handed out in order.
+    for (auto it = SlotsPerSlab; it > 0; --it)
+    {
+        void * slot = slab + (it - 1) * slotSize;
+        *static_cast<void **>(slot) = freeList;
+        freeList = slot;
+    }
+}
+
+void * SlabAllocator::allocate(const char * family, size_t size)
+{
+    return getPool(family, size).allocate();
+}
+
+void SlabAllocator::deallocate(const char * family, void * pointer,
+                               size_t size)
+{
+    if (pointer != nullptr)
+    {
+        getPool(family, size).deallocate(pointer);
+    }
+}
+
+/// The pools, indexed by family and size.
+using SlabPoolMap = std::map<std::pair<const char *, size_t>,
+                             std::unique_ptr<SlabPool>>;
+
+/// Mutex used to protect the map of pools.
+static std::mutex & GetPoolsMutex()
+{
+    static auto poolsMutex = new std::mutex();
+    return *poolsMutex;
+}
+
+/// Provides the map of pools.
+static SlabPoolMap & GetPools()
+{
+    // The pools are never destroyed, since the objects still alive at exit
+    //  (e.g. the ones deleted by the destructor of the Mud) must be able to
+    //  give their slot back.
+    static auto pools = new SlabPoolMap();
+    return *pools;
+}
+
+std::vector<SlabPoolStatistics> SlabAllocator::getStatistics()
+{
+    std::lock_guard<std::mutex> lock(GetPoolsMutex());
+    std::vector<SlabPoolStatistics> statistics;
+    for (auto const & it : GetPools())
+    {
+        statistics.emplace_back(it.second->getStatistics());
+    }
+    return statistics;
+}
+
+SlabPool & SlabAllocator::getPool(const char * family, size_t size)
+{
+    std::lock_guard<std::mutex> lock(GetPoolsMutex());
+    auto & pool = GetPools()[std::make_pair(family, size)];
+    if (pool == nullptr)
+    {
+        pool = std::make_unique<SlabPool>(family, size);
+    }
+    return *pool;
+}
@@ -19,29 +19,92 @@
 #include "utilities/table.hpp"
 #include "utilities/logger.hpp"
 
+/// @brief Appends the value aligned inside the given width, the same way
+///         Align does, without building temporary strings.
+static void AppendAligned(std::string & output,
+                          const std::string & value,
+                          align::align_t alignment,
+                          size_t width)
+{
+    if (value.size() >= width)
+    {
+        output.append(value);
+        return;
+    }
+    auto padding = width - value.size();
+    auto before = (alignment == align::right) ? padding :
+                  (alignment == align::center) ? (width + value.size()) / 2 -
+                                                 value.size() : 0;
+    output.append(before, ' ');
+    output.append(value);
+    output.append(padding - before, ' ');
+}
+
 std::string Table::getTable(bool withoutHeaders,
-                            bool withoutDividers)
+                            bool withoutDividers) const
 {
     std::string output;
+    this->renderTable(output, withoutHeaders, withoutDividers);
+    return output;
+}
+
+void Table::renderTable(std::string & output,
+                        bool withoutHeaders,
+                        bool withoutDividers) const
+{
+    // Every line is as wide as the table, plus the borders and the newline.
+    auto lineWidth = this->getTotalWidth() + columns.size() + 2;
+    auto lines = rows.size();
+    if (!title.empty()) lines += (withoutDividers) ? 1 : 2;
+    if (!withoutHeaders) lines += (withoutDividers) ? 1 : 2;
+    if (!withoutDividers) lines += 2;
+    output.reserve(output.size() + lines * lineWidth);
     // Add the title, if necessary.
     if (!title.empty())
-        output += ((withoutDividers) ? "" : getDivider()) + getTitle();
+    {
+        if (!withoutDividers) this->renderDivider(output);
+        output.push_back('#');
+        AppendAligned(output, title, align::center,
+                      this->getTotalWidth() + (columns.size() - 1));
+        output.append("#\n");
+    }
     // Add the headers, if necessary.
     if (!withoutHeaders)
-        output += ((withoutDividers) ? "" : getDivider()) + getHeaders();
-    // Star with the table.
-    output += ((withoutDividers) ? "" : getDivider());
-    for (auto const & row : rows)
     {
-        for (size_t i = 0; i < row.size(); ++i)
+        if (!withoutDividers) this->renderDivider(output);
+        for (auto const & column : columns)
         {
-            output += "|" + Align(
-                row.at(i),
-                columns.at(i).getAlignment(),
-                columns.at(i).getWidth());
+            output.push_back('|');
+            AppendAligned(output, column.getTitle(), align::center,
+                          column.getWidth());
         }
-        output += "|\n";
+        output.append("|\n");
     }
-    output += ((withoutDividers) ? "" : getDivider());
-    return output;
-}
\ No newline at end of file
+    // Star with the table.
+    if (!withoutDividers) this->renderDivider(output);
+    for (auto const & row : rows)
+    {
+        this->renderLine(output, row);
+    }
+    if (!withoutDividers) this->renderDivider(output);
+}
+
+void Table::renderDivider(std::string & output) const
+{
+    for (auto const & column : columns)
+    {
+        output.append(column.getWidth() + 1, '#');
+    }
+    output.append("#\n");
+}
+
+void Table::renderLine(std::string & output, const TableRow & row) const
+{
+    for (size_t i = 0; i < row.size(); ++i)
+    {
+        output.push_back('|');
+        AppendAligned(output, row[i], columns[i].getAlignment(),
+                      columns[i].getWidth());
+    }
+    output.append("|\n");
+}
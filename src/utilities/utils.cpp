@@ -41,12 +41,34 @@ double SafeLog10(const double & source)
     return 0;
 }
 
-bool BeginWith(const std::string & source, const std::string & prefix)
+bool BeginWith(std::string_view source, std::string_view prefix)
 {
     return source.compare(0, prefix.size(), prefix) == 0;
 }
 
-bool EndWith(const std::string & source, const std::string & suffix)
+bool BeginWithNoCase(std::string_view source, std::string_view prefix)
+{
+    if (source.size() < prefix.size())
+    {
+        return false;
+    }
+    for (std::string_view::size_type i = 0; i < prefix.size(); ++i)
+    {
+        if (tolower(static_cast<unsigned char>(source[i])) !=
+            tolower(static_cast<unsigned char>(prefix[i])))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool EqualNoCase(std::string_view first, std::string_view second)
+{
+    return (first.size() == second.size()) && BeginWithNoCase(first, second);
+}
+
+bool EndWith(std::string_view source, std::string_view suffix)
 {
     return (source.size() >= suffix.size()) &&
            (source.compare(source.size() - suffix.size(),
@@ -55,46 +77,72 @@ bool EndWith(const std::string & source, const std::string & suffix)
 }
 
 void FindAndReplace(std::string * source,
-                    const std::string & target,
-                    const std::string & replacement)
+                    std::string_view target,
+                    std::string_view replacement)
 {
-    size_t start_pos = 0;
-    while ((start_pos = source->find(target, start_pos)) != std::string::npos)
+    if (target.empty())
     {
-        source->replace(start_pos, target.length(), replacement);
-        start_pos += replacement.length();
+        return;
     }
+    std::string_view working(*source);
+    auto position = working.find(target);
+    if (position == std::string_view::npos)
+    {
+        return;
+    }
+    // Build the result in a single pass, instead of moving the rest of the
+    // string at each replacement.
+    std::string result;
+    result.reserve(source->size());
+    std::string_view::size_type start = 0;
+    while (position != std::string_view::npos)
+    {
+        result.append(working.data() + start, position - start);
+        result.append(replacement.data(), replacement.size());
+        start = position + target.size();
+        position = working.find(target, start);
+    }
+    result.append(working.data() + start, working.size() - start);
+    source->swap(result);
 }
 
-std::string Trim(const std::string & source, const std::string & trim)
+std::string Trim(std::string_view source, std::string_view trim)
 {
-    std::string working = source;
-    std::string::size_type i = working.find_last_not_of(trim);
-    if (i == std::string::npos)
+    auto last = source.find_last_not_of(trim);
+    if (last == std::string_view::npos)
     {
         return "";
     }
-    return working.erase(i + 1).erase(0, source.find_first_not_of(trim));
+    auto first = source.find_first_not_of(trim);
+    return std::string(source.substr(first, last - first + 1));
+}
+
+std::string ToLower(std::string_view source)
+{
+    std::string working;
+    AppendLower(working, source);
+    return working;
 }
 
-std::string ToLower(const std::string & source)
+void AppendLower(std::string & output, std::string_view source)
 {
-    std::string working = source;
+    auto offset = output.size();
+    output.resize(offset + source.size());
     // Put all the letter to lower case.
-    for (unsigned int i = 0; i < working.length(); i++)
+    for (std::string_view::size_type i = 0; i < source.size(); ++i)
     {
-        working[i] = static_cast<char>(tolower(working[i]));
+        output[offset + i] = static_cast<char>(
+            tolower(static_cast<unsigned char>(source[i])));
     }
-    return working;
 }
 
-std::string ToCapitals(const std::string & source)
+std::string ToCapitals(std::string_view source)
 {
-    std::string working = source;
     // First of all put all the letter to lower case.
-    for (auto & c : working)
+    std::string working = ToLower(source);
+    if (working.empty())
     {
-        c = static_cast<char>(tolower(c));
+        return working;
     }
     // Capitalize the first letter.
     working[0] = static_cast<char>(toupper(working[0]));
@@ -119,20 +167,27 @@ std::string ToCapitals(const std::string & source)
     return working;
 }
 
-std::vector<std::string> SplitString(const std::string & source,
-                                     const std::string & delimiter)
+std::vector<std::string> SplitString(std::string_view source,
+                                     std::string_view delimiter)
 {
     std::vector<std::string> result;
-    size_t pos = 0;
-    std::string tmp = source;
-    while ((pos = tmp.find(delimiter)) != std::string::npos)
+    if (delimiter.empty())
+    {
+        if (!source.empty())
+        {
+            result.emplace_back(source);
+        }
+        return result;
+    }
+    std::string_view::size_type start = 0, pos;
+    while ((pos = source.find(delimiter, start)) != std::string_view::npos)
     {
-        result.push_back(tmp.substr(0, pos));
-        tmp.erase(0, pos + delimiter.length());
+        result.emplace_back(source.substr(start, pos - start));
+        start = pos + delimiter.size();
     }
-    if (!tmp.empty())
+    if (start < source.size())
     {
-        result.push_back(tmp);
+        result.emplace_back(source.substr(start));
     }
     return result;
 }
@@ -191,11 +246,11 @@ std::vector<std::string> GetAllFilesInFolder(
     return files_name;
 }
 
-bool IsNumber(const std::string & source)
+bool IsNumber(std::string_view source)
 {
     for (auto c : source)
     {
-        if (isdigit(c) == 0)
+        if (isdigit(static_cast<unsigned char>(c)) == 0)
         {
             return false;
         }
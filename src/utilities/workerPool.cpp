@@ -0,0 +1,116 @@
+/// @file   workerPool.cpp
+/// @brief  Implements the methods of the class WorkerPool.
+/// @author Enrico Fraccaroli
+/// @date   Oct 19 2026
+/// @copyright
+/// Copyright (c) 2016 Enrico Fraccaroli <enrico.fraccaroli@gmail.com>
+/// Permission to use, copy, modify, and distribute this software for any
+/// purpose with or without fee is hereby granted, provided that the above
+/// copyright notice and this permission notice appear in all copies.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+/// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+/// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+/// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+/// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+/// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+/// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#include "utilities/workerPool.hpp"
+
+#include <algorithm>
+
+WorkerPool::WorkerPool(unsigned int numBands) :
+    workers(),
+    mutex(),
+    wakeUp(),
+    finished(),
+    body(),
+    count(),
+    generation(),
+    pending(),
+    stopping()
+{
+    if (numBands == 0)
+    {
+        numBands = std::max(1U, std::thread::hardware_concurrency());
+    }
+    // The calling thread executes the first band.
+    for (size_t band = 1; band < numBands; ++band)
+    {
+        workers.emplace_back(&WorkerPool::workerLoop, this, band);
+    }
+}
+
+WorkerPool::~WorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wakeUp.notify_all();
+    for (auto & worker : workers)
+    {
+        worker.join();
+    }
+}
+
+void WorkerPool::parallelFor(const size_t & _count, const Body & _body)
+{
+    // It is not worth waking up the workers for a handful of iterations.
+    if (workers.empty() || (_count < this->size()))
+    {
+        _body(0, _count, 0);
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        body = &_body;
+        count = _count;
+        pending = workers.size();
+        ++generation;
+    }
+    wakeUp.notify_all();
+    size_t begin, end;
+    this->getBand(0, begin, end);
+    _body(begin, end, 0);
+    std::unique_lock<std::mutex> lock(mutex);
+    finished.wait(lock, [this]() { return pending == 0; });
+    body = nullptr;
+}
+
+void WorkerPool::getBand(const size_t & band, size_t & begin, size_t & end) const
+{
+    auto bands = this->size();
+    auto bandSize = count / bands, remainder = count % bands;
+    begin = band * bandSize + std::min(band, remainder);
+    end = begin + bandSize + ((band < remainder) ? 1 : 0);
+}
+
+void WorkerPool::workerLoop(const size_t & band)
+{
+    unsigned long lastGeneration = 0;
+    while (true)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        wakeUp.wait(lock, [&]()
+        {
+            return stopping || (generation != lastGeneration);
+        });
+        if (stopping)
+        {
+            return;
+        }
+        lastGeneration = generation;
+        size_t begin, end;
+        this->getBand(band, begin, end);
+        auto current = body;
+        lock.unlock();
+        (*current)(begin, end, band);
+        lock.lock();
+        if (--pending == 0)
+        {
+            finished.notify_one();
+        }
+    }
+}